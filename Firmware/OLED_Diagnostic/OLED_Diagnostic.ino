@@ -4,21 +4,51 @@
 #define SCREEN_HEIGHT 64
 #define OLED_RESET -1
 #define TCA_ADDRESS 0x70
+#define OLED_ADDRESS 0x3C
 
-#define DIAG_VERSION "diagnostic_v1.0"
+#define DIAG_VERSION "diagnostic_v1.1"
+
+// Bus characterisation: every clock below is tried on every channel that
+// answered at boot. Send DIAG over serial to run it again.
+static const uint32_t DIAG_CLOCKS[] = { 100000, 400000, 700000, 1000000 };
+#define DIAG_NUM_CLOCKS (sizeof(DIAG_CLOCKS) / sizeof(DIAG_CLOCKS[0]))
+#define DIAG_SELECTS    100   // tcaSelect() samples per channel
+#define DIAG_PROBES     100   // SSD1306 NOP writes per channel
+#define DIAG_FRAMES     10    // full frames per channel for fps
 
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
-void tcaSelect(uint8_t i) {
-  if (i > 7) return;
+static bool present[8] = {};
+
+void characteriseBus();
+void printSummary();
+
+// Returns the Wire status: 0 ok, 2/3 NACK, 5 timeout, anything else error
+uint8_t tcaSelect(uint8_t i) {
+  if (i > 7) return 4;
   Wire.beginTransmission(TCA_ADDRESS);
   Wire.write(1 << i);
-  Wire.endTransmission();
+  return Wire.endTransmission();
+}
+
+struct ChannelStats {
+  uint32_t txns, nacks, timeouts, errors;
+  uint32_t selSumUs, selMaxUs;
+  float    fps;
+};
+static ChannelStats stats[DIAG_NUM_CLOCKS][8];
+
+static void countResult(ChannelStats &st, uint8_t rc) {
+  st.txns++;
+  if (rc == 2 || rc == 3) st.nacks++;
+  else if (rc == 5)       st.timeouts++;
+  else if (rc != 0)       st.errors++;
 }
 
 void setup() {
   Serial.begin(115200);
   Wire.begin();
+  Wire.setTimeOut(20);
 
   Serial.println();
   Serial.println("=== TDS-8 OLED Diagnostic ===");
@@ -27,14 +57,17 @@ void setup() {
   for (uint8_t ch = 0; ch < 8; ch++) {
     Serial.printf("Testing TCA channel %d...\n", ch);
     tcaSelect(ch);
-    if (!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) {
+    if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDRESS)) {
       Serial.printf("❌ OLED not found on channel %d\n", ch);
     } else {
+      present[ch] = true;
       Serial.printf("✅ OLED FOUND on channel %d\n", ch);
       display.clearDisplay();
       display.display();
     }
   }
+
+  characteriseBus();
 }
 
 // Simple fast animations per OLED to exercise pixels/geometry
@@ -76,18 +109,125 @@ static void animChecker(uint8_t ch, uint32_t f) {
   }
 }
 
+static void drawAnimFrame(uint8_t ch, uint32_t f) {
+  display.clearDisplay();
+  // Different pattern per channel, all animated over time
+  switch (ch % 4) {
+    case 0: animRects(ch, f); break;
+    case 1: animLines(ch, f); break;
+    case 2: animCircles(ch, f); break;
+    case 3: animChecker(ch, f); break;
+  }
+}
+
+// ===================  Bus characterisation  ===================
+// Per clock and channel: tcaSelect() latency, NACK/timeout/error counts over
+// the selects plus a burst of SSD1306 NOP writes, and how many full frames a
+// second the panel takes. Adafruit_SSD1306 switches the bus to its own clock
+// around display(), so frames go through a second instance built for the
+// clock under test, fed from the main buffer.
+static void measureChannel(Adafruit_SSD1306 &probe, uint32_t hz, uint8_t ch, ChannelStats &st) {
+  memset(&st, 0, sizeof(st));
+  Wire.setClock(hz);
+
+  for (int n = 0; n < DIAG_SELECTS; n++) {
+    uint32_t t = micros();
+    uint8_t rc = tcaSelect(ch);
+    uint32_t us = micros() - t;
+    countResult(st, rc);
+    st.selSumUs += us;
+    if (us > st.selMaxUs) st.selMaxUs = us;
+  }
+
+  for (int n = 0; n < DIAG_PROBES; n++) {
+    Wire.beginTransmission(OLED_ADDRESS);
+    Wire.write(0x00);   // command stream
+    Wire.write(0xE3);   // NOP
+    countResult(st, Wire.endTransmission());
+  }
+
+  uint32_t t = micros();
+  for (int f = 0; f < DIAG_FRAMES; f++) {
+    drawAnimFrame(ch, f);
+    memcpy(probe.getBuffer(), display.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT / 8);
+    probe.display();
+  }
+  uint32_t us = micros() - t;
+  st.fps = us ? DIAG_FRAMES * 1e6f / us : 0;
+}
+
+void characteriseBus() {
+  Serial.println("=== Bus characterisation ===");
+  for (uint8_t c = 0; c < DIAG_NUM_CLOCKS; c++) {
+    uint32_t hz = DIAG_CLOCKS[c];
+    Adafruit_SSD1306 probe(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET, hz, hz);
+    bool ready = false;
+    for (uint8_t ch = 0; ch < 8; ch++) {
+      if (!present[ch]) continue;
+      if (!ready) {
+        // Allocates the buffer; re-inits this panel at the test clock
+        tcaSelect(ch);
+        ready = probe.begin(SSD1306_SWITCHCAPVCC, OLED_ADDRESS, false, false);
+        if (!ready) { Serial.println("❌ Out of memory for probe buffer"); return; }
+      }
+      ChannelStats &st = stats[c][ch];
+      measureChannel(probe, hz, ch, st);
+      Serial.printf("%7lu Hz ch%d: %5.1f fps  select %lu us avg / %lu us max  nack %lu  timeout %lu  err %lu  (of %lu)\n",
+                    (unsigned long)hz, ch, st.fps,
+                    (unsigned long)(st.selSumUs / DIAG_SELECTS), (unsigned long)st.selMaxUs,
+                    (unsigned long)st.nacks, (unsigned long)st.timeouts, (unsigned long)st.errors,
+                    (unsigned long)st.txns);
+    }
+  }
+  Wire.setClock(400000);
+  printSummary();
+}
+
+// One line for the bridge to store: DIAG: {"version":...,"clocks":[...]}
+void printSummary() {
+  Serial.printf("DIAG: {\"version\":\"%s\",\"channels\":[", DIAG_VERSION);
+  bool first = true;
+  for (uint8_t ch = 0; ch < 8; ch++) {
+    if (!present[ch]) continue;
+    Serial.printf("%s%d", first ? "" : ",", ch);
+    first = false;
+  }
+  Serial.print("],\"clocks\":[");
+  for (uint8_t c = 0; c < DIAG_NUM_CLOCKS; c++) {
+    Serial.printf("%s{\"hz\":%lu,\"results\":[", c ? "," : "", (unsigned long)DIAG_CLOCKS[c]);
+    first = true;
+    for (uint8_t ch = 0; ch < 8; ch++) {
+      if (!present[ch]) continue;
+      const ChannelStats &st = stats[c][ch];
+      Serial.printf("%s{\"ch\":%d,\"fps\":%.1f,\"sel_us\":%lu,\"sel_max_us\":%lu,"
+                    "\"txns\":%lu,\"nack\":%lu,\"timeout\":%lu,\"err\":%lu}",
+                    first ? "" : ",", ch, st.fps,
+                    (unsigned long)(st.selSumUs / DIAG_SELECTS), (unsigned long)st.selMaxUs,
+                    (unsigned long)st.txns, (unsigned long)st.nacks,
+                    (unsigned long)st.timeouts, (unsigned long)st.errors);
+      first = false;
+    }
+    Serial.print("]}");
+  }
+  Serial.println("]}");
+}
+
 void loop() {
+  static String cmd;
+  while (Serial.available() > 0) {
+    char c = (char)Serial.read();
+    if (c == '\r') continue;
+    if (c != '\n') { if (cmd.length() < 32) cmd += c; continue; }
+    cmd.trim();
+    if (cmd.equalsIgnoreCase("diag")) characteriseBus();
+    else if (cmd.equalsIgnoreCase("version")) { Serial.print("VERSION: "); Serial.println(DIAG_VERSION); }
+    cmd = "";
+  }
+
   frame++;
   for (uint8_t ch = 0; ch < 8; ch++) {
     tcaSelect(ch);
-    display.clearDisplay();
-    // Different pattern per channel, all animated over time
-    switch (ch % 4) {
-      case 0: animRects(ch, frame); break;
-      case 1: animLines(ch, frame); break;
-      case 2: animCircles(ch, frame); break;
-      case 3: animChecker(ch, frame); break;
-    }
+    drawAnimFrame(ch, frame);
     display.display();
   }
   // Keep animations fast; avoid long delays
@@ -16,11 +16,27 @@
   - Serial commands for full control via desktop bridge
   - Optional WiFi mode (enable via serial/web command)
   - Consumer-friendly plug-and-play experience
-  - GitHub OTA firmware updates
+  - GitHub OTA firmware updates; gzip'd images inflated while streaming,
+    SHA-256 checked before the new partition is made bootable
+  - FWU serial commands: in-app update over USB in acked, resumable chunks
+    with progress on the screens (no bootloader reset)
+  - Idle policy: panels dim, then switch off, when no commands arrive; CPU
+    clocks down and loop() stops spinning. Any input wakes them in one frame
   - 8x SSD1306 via TCA9548A (manual tcaSelect)
+  - Queued I2C frame flush (ESP-IDF i2c_master): next screen renders while
+    the previous one is still on the bus
+  - Up to 4 TCA9548A muxes (0x70-0x73, 8 screens each), counted at boot;
+    screens flush round-robin and only changed pages go out
+  - Compressed page-major artwork; animated boot reveal played from loop()
+  - UTF-8 track names: accented Latin and common symbols from a compact
+    glyph store, rasterised glyphs kept in an LRU cache
+  - BENCH serial command: latency/fps/I2C bytes for replayed command traces
   - Serial: /trackname, /activetrack, VERSION, WIRED_ONLY, WIFI_ON, etc.
-  - OSC (WiFi mode): /trackname, /activetrack, /reannounce
+  - OSC (WiFi mode): /trackname, /activetrack, /reannounce; unicast to the
+    sender of the first packet (leased), subnet broadcast until then
   - Web UI (WiFi mode): http://tds8.local
+  - mDNS (WiFi mode): _osc._udp and _http._tcp with id/fw/tracks TXT
+    records; instance names carry the MAC tail so a rack stays distinct
   - OTA updates from GitHub releases
 **********************************************************************/
 
@@ -37,10 +53,20 @@
 #include <ESPmDNS.h>
 #include <Preferences.h>
 #include <ArduinoJson.h>
+#include <esp_timer.h>
 
 #include <HTTPClient.h>
-#include <HTTPUpdate.h>
 #include <WiFiClientSecure.h>
+#include <Update.h>
+#include "mbedtls/sha256.h"
+#include "mbedtls/base64.h"
+
+// OTA images may be gzip'd; the ROM carries an inflater (tinfl) we can use
+// without linking another copy. Cores without it take plain .bin only.
+#if __has_include("rom/miniz.h")
+#  include "rom/miniz.h"
+#  define HAVE_ROM_INFLATE 1
+#endif
 
 // =======================  Firmware  =======================
 #define FW_VERSION "0.98"   // Bump this when you publish a new firmware
@@ -48,14 +74,57 @@
 #define GITHUB_MANIFEST_URL "https://raw.githubusercontent.com/m1llipede/tds8/main/manifest.json"
 #define DEMO_FILM_MODE 0
 
+// =======================  Serial  ==========================
+#define SERIAL_RX_BUFFER  4096    // room for a window of FWU DATA lines
+#define SERIAL_LINE_MAX   1280    // longest command line kept
+
 // =======================  OLED / I2C  ======================
 #define SCREEN_WIDTH   128
 #define SCREEN_HEIGHT   64
 #define OLED_RESET     -1
 #define I2C_ADDR        0x3C
-#define TCA_ADDRESS     0x70
+#define TCA_ADDRESS     0x70   // first TCA9548A; extra muxes strap to 0x71..0x73
+#define MAX_MUXES       4
+#define MAX_SCREENS     (MAX_MUXES * 8)
+
+// =======================  Async I2C flush  =================
+// After boot the panels are fed through the ESP-IDF I2C master driver in
+// queued mode: display() stores the GFX buffer as the screen's pending frame
+// and returns. A flush task hands pending frames to the I2C ISR round-robin
+// across screens, sending only the pages that changed, so the next screen
+// can be laid out during the transfer and one busy screen can't starve the
+// rest. Cores without i2c_master.h keep the blocking Wire path.
+#if __has_include("driver/i2c_master.h")
+#  include "driver/i2c_master.h"
+#  define HAVE_ASYNC_I2C 1
+#endif
+#define OLED_I2C_HZ        400000
+#define FLUSH_QUEUE_DEPTH  4      // frames that may be in flight at once
+#define FLUSH_BULK_DEPTH   1      // of those, how many may be name renders
+#define FLUSH_BULK_PAGES   4      // name renders go out at most this many pages per job
+
+// =======================  Idle / power  ====================
+// With no serial line or OSC packet for IDLE_DIM_S the panels drop to
+// CONTRAST_DIM; after IDLE_OFF_S they are switched off (their RAM keeps
+// the picture). After /ableton_off the dim timer is cut to
+// IDLE_ABLETON_OFF_DIM_S. Both times can be changed with IDLE over serial.
+#define IDLE_DIM_S              300
+#define IDLE_OFF_S              1200
+#define IDLE_ABLETON_OFF_DIM_S  60
+#define CONTRAST_FULL           0xCF   // Adafruit's SWITCHCAPVCC default
+#define CONTRAST_DIM            0x08
+#define IDLE_POLL_MS            5      // loop() sleeps this long per pass once idle
+#define CPU_MHZ_ACTIVE          160
+#define CPU_MHZ_IDLE            80     // lowest clock WiFi still runs at
+
+class QueuedSSD1306 : public Adafruit_SSD1306 {
+public:
+  using Adafruit_SSD1306::Adafruit_SSD1306;
+  void display();                 // mark the buffer pending for the selected screen
+  void invertDisplay(bool i);     // latched per screen, sent with the next frame
+};
 
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+QueuedSSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
 // Optional: TDS-8 logo bitmaps per-screen (T, D, S, '-', '8').
 // If headers exist, we include and use them; otherwise we fall back to text.
@@ -86,6 +155,21 @@ Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 #  define HAVE_SCRIBBLE_BITMAP 1
 #endif
 
+// PlayOptix logo (OLED 8), always bundled
+#include "playoptix_bitmap.h"
+
+// Optional: animated boot reveal (generate_bitmaps.js ANIMS)
+#if __has_include("boot_anim.h")
+#  include "boot_anim.h"
+#  define HAVE_BOOT_ANIM 1
+#endif
+
+// Optional: glyphs beyond ASCII for track names (generate_glyphs.js)
+#if __has_include("utf8_glyphs.h")
+#  include "utf8_glyphs.h"
+#  define HAVE_UTF8_GLYPHS 1
+#endif
+
 // =======================  State Machine for Startup =======================
 enum AppState {
   STATE_STARTUP_SPLASH,
@@ -97,9 +181,11 @@ unsigned long stateTransitionTime = 0;
 
 // =======================  Graphics / Bitmaps  ==============
 void tcaSelect(uint8_t i); // forward declaration
+extern int numScreens;     // defined with the track state below
 // Show TDS-8 and Playoptix logo splash on all screens for 3 seconds
+// (held by the startup state machine, loop() keeps running)
 void showLogosSplash() {
-  for (uint8_t i = 0; i < 8; ++i) {
+  for (uint8_t i = 0; i < numScreens; ++i) {
     tcaSelect(i);
     display.clearDisplay();
     display.setTextSize(2);
@@ -111,96 +197,57 @@ void showLogosSplash() {
     display.println("by Playoptix");
     display.display();
   }
-  delay(3000);
-}
-
-// PlayOptix logo - 128x64px (full display)
-const unsigned char playoptix_logo [] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x30, 0x00, 0x00, 0x00,
-  0x78, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0x30, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x07, 0x30, 0x00, 0x00, 0x03, 0x87, 0x00, 0x01, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x00, 0x07,
-  0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01,
-  0xb0, 0xf8, 0x60, 0x6e, 0x01, 0xc3, 0xe1, 0xf2, 0x60, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x01, 0xb1, 0xfc, 0x60, 0x6c, 0x00, 0xcf, 0xf1, 0xf6,
-  0x70, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xb3, 0x86, 0x60, 0x4c,
-  0x00, 0xcc, 0x39, 0x86, 0x39, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07,
-  0x33, 0x06, 0x60, 0x4c, 0x00, 0xdc, 0x19, 0x86, 0x1b, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0xff, 0x36, 0x03, 0x60, 0x6c, 0x00, 0xd8, 0x0d, 0x86,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7c, 0x36, 0x03, 0x60, 0x6c,
-  0x01, 0xd8, 0x0d, 0x86, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x33, 0x03, 0x60, 0xe6, 0x01, 0x98, 0x19, 0x86, 0x1d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x33, 0x03, 0x70, 0xe7, 0x03, 0x98, 0x19, 0xc6,
-  0x39, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x33, 0xfb, 0x3f, 0xe3,
-  0xff, 0x1b, 0xf0, 0xff, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x30, 0xfb, 0x1f, 0xe1, 0xfc, 0x1b, 0xe0, 0x7f, 0xe0, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1e, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00
-};
+  currentState = STATE_STARTUP_SPLASH;
+  stateTransitionTime = millis() + 3000;
+}
 
-#define LOGO_WIDTH  128
-#define LOGO_HEIGHT 64
+// Full-screen 128x64 images are stored page-major and PackBits compressed
+// (generate_bitmaps.js *_RLE). Runs expand with memset/memcpy straight into
+// the buffer layout the flush path sends, so the mostly-black logos touch
+// a few hundred bytes of flash instead of 1 KB and need no per-pixel work.
+size_t unpackBits(const uint8_t* src, uint8_t* dst, size_t len) {
+  const uint8_t* start = src;
+  uint8_t* const end = dst + len;
+  while (dst < end) {
+    int8_t n = (int8_t)pgm_read_byte(src++);
+    if (n >= 0) {
+      size_t cnt = min((size_t)n + 1, (size_t)(end - dst));
+      memcpy_P(dst, src, cnt);
+      src += n + 1; dst += cnt;
+    } else if (n != -128) {
+      size_t cnt = min((size_t)(1 - n), (size_t)(end - dst));
+      memset(dst, pgm_read_byte(src++), cnt);
+      dst += cnt;
+    }
+  }
+  return src - start;   // packed bytes consumed
+}
+
+static inline void blitPackBits(const uint8_t* rle) {
+  unpackBits(rle, display.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT / 8);
+}
+
+// Same stream format, XORed onto dst (animation diff pages)
+static size_t xorUnpackBits(const uint8_t* src, uint8_t* dst, size_t len) {
+  const uint8_t* start = src;
+  uint8_t* const end = dst + len;
+  while (dst < end) {
+    int8_t n = (int8_t)pgm_read_byte(src++);
+    if (n >= 0) {
+      for (int k = 0; k <= n; k++, src++) if (dst < end) *dst++ ^= pgm_read_byte(src);
+    } else if (n != -128) {
+      uint8_t v = pgm_read_byte(src++);
+      for (int k = 0; k < 1 - n && dst < end; k++) *dst++ ^= v;
+    }
+  }
+  return src - start;
+}
 
 // =======================  Tracks / UI  =====================
-const int numScreens = 8;
-String trackNames[numScreens] = {"", "", "", "", "", "", "", ""}; // Start blank
-int actualTrackNumbers[numScreens] = {0, 1, 2, 3, 4, 5, 6, 7}; // Actual track numbers for offset support
+int numScreens = 8;                  // 8 per TCA9548A found at boot (see detectMuxes)
+uint8_t muxCount = 1;
+String trackNames[MAX_SCREENS];      // Start blank
+int actualTrackNumbers[MAX_SCREENS] = {0, 1, 2, 3, 4, 5, 6, 7}; // Actual track numbers for offset support
 int activeTrack = -1;
 bool abletonConnected = false;
 bool showingDisconnectMessage = false;
@@ -231,11 +278,16 @@ bool wiredOnly = true;  // DEFAULT: wired mode, WiFi OFF
 bool wifiEnabled = false;
 
 // ==================  MULTI-DEVICE SUPPORT  ====================
-uint8_t deviceID = 0;  // Device ID (0-3), determines track offset
+#define MAX_DEVICE_ID 15  // the bridge routes up to 16 units (128 tracks)
+#define TRACKS_PER_ID 8   // one DEVICE_ID step = one 8-track block
+uint8_t deviceID = 0;  // Device ID (0-MAX_DEVICE_ID), determines track offset
 // Device 0 = tracks 0-7 (displayed as 1-8)
 // Device 1 = tracks 8-15 (displayed as 9-16)
-// Device 2 = tracks 16-23 (displayed as 17-24)
-// Device 3 = tracks 24-31 (displayed as 25-32)
+// ...
+// Device 15 = tracks 120-127 (displayed as 121-128)
+// A unit with more muxes shows one block per mux from its offset: a
+// 16-screen unit at ID 0 covers tracks 1-16, so the next unit takes ID 2.
+// The bridge learns the width from SCREENS in the VERSION reply.
 
 // ==================  Network / services  ==================
 Preferences prefs;
@@ -245,6 +297,7 @@ WiFiUDP      Udp;
 const uint16_t oscPort         = 8000;    // OSC listener
 const uint16_t ipBroadcastPort = 9000;    // broadcast lease + /ipupdate
 const char*   mdnsName         = "tds8";  // http://tds8.local/
+bool          mdnsUp           = false;   // responder started (WiFi mode)
 
 // Captive-portal AP creds
 const char* AP_SSID = "TDS8";
@@ -276,16 +329,112 @@ unsigned long nextBeaconAt      = 0;
 const unsigned long beaconPeriodMs = 5000;
 const unsigned long beaconWindowMs = 60000;
 
+// OSC peer: the host of the first valid OSC packet. While its lease runs,
+// /hello and /ipupdate go to it unicast; anything it sends renews the lease
+// and the /hello every beaconPeriodMs is the keep-alive (M4L answers /hi).
+// Once the lease lapses we fall back to subnet-broadcast beacons.
+const unsigned long peerLeaseMs = 20000;
+IPAddress     oscPeer;
+unsigned long oscPeerUntil = 0;            // 0 = no peer
+
 // UI state tracking
 bool          abletonBannerShown = false;
 bool          quickStartShown    = false;
 volatile bool wantAbletonBanner = false;
 
+// =======================  Animation player  ================
+// Plays generate_bitmaps.js animation containers (see encodeAnim there).
+// Each record is a page mask plus XOR pages, applied to a per-screen copy;
+// animStep() is called from loop() and flushes only screens that changed,
+// so serial and OSC keep being serviced between frames.
+#define ANIM_FRAME_BYTES (SCREEN_WIDTH * SCREEN_HEIGHT / 8)
+
+struct AnimPlayer {
+  const uint8_t* data = nullptr;   // next record, nullptr when idle
+  uint8_t  screens    = 0;
+  uint16_t framesLeft = 0;
+  uint16_t periodMs   = 0;
+  unsigned long nextAt = 0;
+  uint8_t* frames     = nullptr;   // screens x 1 KB, current picture per screen
+};
+static AnimPlayer anim;
+
+bool animPlaying() { return anim.data != nullptr; }
+
+void animStop() {
+  free(anim.frames);
+  anim = AnimPlayer();
+}
+
+bool animStart(const uint8_t* data, uint16_t frames, uint8_t screens, uint16_t periodMs) {
+  animStop();
+  anim.frames = (uint8_t*)calloc(screens, ANIM_FRAME_BYTES);
+  if (!anim.frames) return false;
+  anim.data       = data;
+  anim.screens    = screens;
+  anim.framesLeft = frames;
+  anim.periodMs   = periodMs;
+  anim.nextAt     = millis();
+  return true;
+}
+
+static void animDecodeFrame(uint32_t& changed) {
+  for (uint8_t s = 0; s < anim.screens; s++) {
+    uint8_t mask = pgm_read_byte(anim.data++);
+    if (!mask) continue;
+    changed |= 1UL << s;
+    for (uint8_t p = 0; p < SCREEN_HEIGHT / 8; p++) {
+      if (mask & (1 << p)) {
+        anim.data += xorUnpackBits(anim.data, anim.frames + s * ANIM_FRAME_BYTES + p * SCREEN_WIDTH, SCREEN_WIDTH);
+      }
+    }
+  }
+  anim.framesLeft--;
+}
+
+static void animShow(uint32_t changed) {
+  for (uint8_t s = 0; s < anim.screens && s < numScreens; s++) {
+    if (!(changed & (1UL << s))) continue;
+    tcaSelect(s);
+    display.invertDisplay(false);
+    memcpy(display.getBuffer(), anim.frames + s * ANIM_FRAME_BYTES, ANIM_FRAME_BYTES);
+    display.display();
+  }
+}
+
+void animStep() {
+  if (!anim.data || (long)(millis() - anim.nextAt) < 0) return;
+  uint32_t changed = 0;
+  animDecodeFrame(changed);
+  animShow(changed);
+  // Running late (setup blocked on WiFi etc.): carry on from now, don't burst
+  if ((long)(millis() - anim.nextAt) > anim.periodMs) anim.nextAt = millis();
+  anim.nextAt += anim.periodMs;
+  if (!anim.framesLeft) animStop();
+}
+
+// Jump to the last frame so something else can draw over the screens
+void animFinish() {
+  if (!anim.data) return;
+  uint32_t changed = 0;
+  while (anim.framesLeft) animDecodeFrame(changed);
+  animShow(changed);
+  animStop();
+}
+
 // ===================  Forward decls  ======================
 void tcaSelect(uint8_t i);
+void detectMuxes();
+void oledBusBegin();
+void oledSetLevel(uint8_t level);
 void drawTrackName(uint8_t screen, const String& name);
 void refreshAll();
+void queueNameRender(uint8_t screen);
+void drawTrackNameUrgent(uint8_t screen);
+bool serviceNameRenders();
 void showNetworkSetup();
+void showWiFiConnecting();
+void showWiFiRetrying();
 void showNetworkSplash(const String& ip);
 void showQuickStartLoop();
 void showAbletonConnectedAll(uint16_t ms = 1000);
@@ -296,6 +445,12 @@ void handleActiveTrack(OSCMessage &msg);
 void handleReannounceOSC(OSCMessage &msg);
 void handleHi(OSCMessage &msg);
 void sendHelloToM4L();
+IPAddress subnetBroadcast();
+bool oscPeerValid();
+IPAddress oscTarget();
+void learnOscPeer(IPAddress from);
+void mdnsStart();
+void mdnsUpdateTxt();
 void handleTracksReset();
 
 void handleRoot();
@@ -328,6 +483,10 @@ void drawLines(uint8_t ts, int y0, const char* l1=nullptr, const char* l2=nullpt
 void handleSerialLine(const String& line);
 void saveWiredMode();
 void loadWiredMode();
+void noteInput();
+void idleService();
+void saveIdleTimes();
+void loadIdleTimes();
 void saveDeviceID();
 void loadDeviceID();
 void showStartupSplash();
@@ -366,6 +525,7 @@ void setup() {
   Wire.begin();
   Wire.setClock(400000);
   Wire.setTimeOut(15);
+  detectMuxes();
 
   for (uint8_t i = 0; i < numScreens; i++) {
     tcaSelect(i);
@@ -376,6 +536,7 @@ void setup() {
       display.display();
     }
   }
+  oledBusBegin();
 
   deviceID = 0;
   for (int i = 0; i < numScreens; i++) {
@@ -396,6 +557,7 @@ void setup() {
   return;
 #endif
 
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
   Serial.begin(115200);
   delay(100);
   
@@ -405,6 +567,10 @@ void setup() {
 
   Serial.println("\n\n=== TDS-8 v0.98 ===");
 
+  // Count muxes (8 screens each) before touching any panel
+  detectMuxes();
+  Serial.printf("SCREENS: %d (%d mux)\n", numScreens, muxCount);
+
   // Init all OLEDs
   for (uint8_t i = 0; i < numScreens; i++) {
     tcaSelect(i);
@@ -416,6 +582,8 @@ void setup() {
       display.display();
     }
   }
+  // Panels are initialised over Wire; from here on frames go out queued
+  oledBusBegin();
 
   // Load config + Wi-Fi creds + persisted track names + wired mode
   loadConfig();
@@ -426,16 +594,17 @@ void setup() {
   Serial.printf("Loaded mode: %s\n", wiredOnly ? "WIRED" : "WIFI");
   // Load saved device ID (defaults to 0 if never set)
   loadDeviceID();
+  loadIdleTimes();
   
   // Initialize actual track numbers based on device ID
-  int offset = deviceID * 8;
+  int offset = deviceID * TRACKS_PER_ID;
   for (int i = 0; i < numScreens; i++) {
     actualTrackNumbers[i] = offset + i;
   }
   
   // CRITICAL FIX: Clear track names if they contain generic "Track X" that doesn't match current device ID
   bool needsClear = false;
-  Serial.printf("DEBUG: Checking track names for deviceID=%d (expected tracks %d-%d)\n", deviceID, offset + 1, offset + 8);
+  Serial.printf("DEBUG: Checking track names for deviceID=%d (expected tracks %d-%d)\n", deviceID, offset + 1, offset + numScreens);
   for (int i = 0; i < numScreens; i++) {
     Serial.printf("DEBUG: Screen %d: trackNames='%s', expectedTrack=%d\n", i, trackNames[i].c_str(), offset + i + 1);
     if (trackNames[i].startsWith("Track ")) {
@@ -563,9 +732,6 @@ void setup() {
     if (!WiFi.softAPgetStationNum()) startRescueAP();
   }
 
-  // mDNS + HTTP
-  MDNS.begin(mdnsName);
-
   // HTTP routes
   server.on("/",             HTTP_GET,  handleRoot);
   server.on("/status",       HTTP_GET,  handleStatus);
@@ -587,6 +753,9 @@ void setup() {
   Udp.begin(oscPort);
   Serial.printf("ðŸŽ§ OSC listening on UDP %u\n", oscPort);
 
+  // mDNS, once both advertised services are actually listening
+  mdnsStart();
+
   broadcastIP();
 
   // Discovery beacons
@@ -607,6 +776,8 @@ void setup() {
 static String serialBuffer = "";
 
 void loop() {
+  animStep();   // boot/transition animation, one frame per period
+
 #if DEMO_FILM_MODE
   loopDemo();
   return;
@@ -614,25 +785,26 @@ void loop() {
   // ========== SERIAL COMMAND HANDLER (ALWAYS ACTIVE, EVEN DURING SPLASH) ==========
   // CRITICAL: Process serial commands BEFORE state machine so DEVICE_ID commands
   // are received immediately, even during the 2-second splash screen
-  static String serialBuffer = "";
+  static String serialBuffer = "";   // longest lines are FWU DATA chunks
   while (Serial.available() > 0) {
     char c = (char)Serial.read();
     if (c == '\r') continue;
     if (c == '\n') {
       if (serialBuffer.length()) {
+        noteInput();
         handleSerialLine(serialBuffer);
         serialBuffer = "";
       }
     } else {
       serialBuffer += c;
-      if (serialBuffer.length() > 512) serialBuffer.remove(0, 1);
+      if (serialBuffer.length() > SERIAL_LINE_MAX) serialBuffer.remove(0, 1);
     }
   }
 
   // ================== STATE MACHINE FOR STARTUP SEQUENCE ==================
   // Check if splash screen time has elapsed and transition to running state
   if (currentState == STATE_STARTUP_SPLASH) {
-    if (millis() >= stateTransitionTime) {
+    if (millis() >= stateTransitionTime && !animPlaying()) {
       Serial.println("âœ… Splash screen complete. Switching to track displays.");
       refreshAll(); // Show track displays with current track names
       currentState = STATE_RUNNING;
@@ -682,6 +854,8 @@ void loop() {
     while ((size = Udp.parsePacket()) > 0) {
       while (size--) msg.fill(Udp.read());
       if (!msg.hasError()) {
+        noteInput();
+        learnOscPeer(Udp.remoteIP());
         msg.dispatch("/hi",          handleHi);
         msg.dispatch("/trackname",   handleTrackName);
         msg.dispatch("/activetrack", handleActiveTrack);
@@ -694,6 +868,13 @@ void loop() {
 
     // Discovery beacons and M4L heartbeat
     unsigned long now = millis();
+    if (oscPeerUntil && (long)(now - oscPeerUntil) >= 0) {
+      oscPeerUntil = 0;
+      Serial.printf("OSC: lease for %s expired, back to broadcast\n", oscPeer.toString().c_str());
+      discoveryActive = true;
+      discoveryUntil  = now + beaconWindowMs;
+      nextBeaconAt    = now;
+    }
     if (discoveryActive) {
       if (now >= discoveryUntil) {
         discoveryActive = false;
@@ -720,14 +901,426 @@ void loop() {
   // ========== WIRED MODE ==========
   else {
   }
+
+  // Bulk lane: one deferred name render per pass, after all input is in
+  serviceNameRenders();
+
+  // Dim/dark panels after a quiet spell; stop spinning while idle
+  idleService();
 }
 
 // ===============  OLED & TCA9548A helpers  ===============
+static uint8_t oledTarget = 0;                   // screen the next frame goes to
+static bool    oledInverted[MAX_SCREENS] = {};   // per-screen invert, sent with each frame
+static bool    oledBusReady = false;             // true once the queued IDF bus owns I2C
+static volatile uint8_t oledLevel = CONTRAST_FULL;  // all panels: contrast, 0 = display off
+static uint8_t wireMux = 0xFF;                   // mux with a channel open on the Wire path
+
+// Two lanes. Urgent frames (highlight moves, heartbeat, meters) are drawn
+// as soon as the command arrives and jump the flush queue. Name renders are
+// deferred: /trackname only records the name and marks the screen, and
+// loop() draws one marked screen per pass, so a 32-name sweep never sits
+// between a highlight change and the glass. Bulk frames may only hold
+// FLUSH_BULK_DEPTH bus slots and FLUSH_BULK_PAGES pages each, bounding how
+// long an urgent frame waits.
+static bool     oledUrgent = false;              // display() calls belong to the urgent lane
+static uint32_t nameDirty  = 0;                  // screens with a name render pending
+static uint8_t  nameCursor = 0;                  // round-robin start for name renders
+
+// Bus accounting for BENCH: frames and bytes handed to the bus, and when
+// the last of them finished (esp_timer us; set from the ISR when queued).
+static uint32_t busFrames = 0;
+static uint32_t busBytes  = 0;
+static volatile int64_t busDoneUs = 0;
+static volatile int64_t urgentDoneUs = 0;   // same, for the last urgent frame
+
+// Adafruit display() over Wire: 5-byte command list, column end, then the
+// buffer in 127-byte chunks that each carry address + 0x40, plus the invert
+// command we send first. Address bytes included.
+#define WIRE_FRAME_BYTES (7 + 3 + 3 + SCREEN_WIDTH * SCREEN_HEIGHT / 8 + \
+                          2 * ((SCREEN_WIDTH * SCREEN_HEIGHT / 8 + 126) / 127))
+
+// Muxes are strapped contiguously from TCA_ADDRESS; each one found adds 8
+// screens. Runs on Wire before any panel is touched and leaves every
+// channel closed, so two muxes never expose their 0x3C panels together.
+void detectMuxes() {
+  uint8_t found = 0;
+  while (found < MAX_MUXES) {
+    Wire.beginTransmission(TCA_ADDRESS + found);
+    Wire.write(0);
+    if (Wire.endTransmission(true) != 0) break;
+    found++;
+  }
+  muxCount   = found ? found : 1;   // nothing answered: behave like a single board
+  numScreens = muxCount * 8;
+  wireMux    = 0xFF;
+}
+
+#if defined(HAVE_ASYNC_I2C)
+#define FRAME_BYTES (SCREEN_WIDTH * SCREEN_HEIGHT / 8)
+#define PAGE_BYTES  SCREEN_WIDTH
+#define FRAME_HDR   21   // up to 10 Co=1 command pairs + 0x40 data control byte
+
+// One queued transfer: TCA select byte + SSD1306 commands + the changed
+// pages. The header is built backwards from the pixels, so it only holds
+// what the panel needs. Buffers must stay untouched until the driver
+// reports the transfer done.
+struct FlushJob {
+  uint8_t sel;
+  uint8_t tx[FRAME_HDR + FRAME_BYTES];
+};
+
+static i2c_master_bus_handle_t oledBus = nullptr;
+static i2c_master_dev_handle_t tcaDev[MAX_MUXES] = {};
+static i2c_master_dev_handle_t oledDev = nullptr;
+static FlushJob          flushJobs[FLUSH_QUEUE_DEPTH];
+static uint8_t           flushHead  = 0;
+static SemaphoreHandle_t flushSlots = nullptr;   // counts free flushJobs
+static SemaphoreHandle_t bulkSlots  = nullptr;   // counts jobs the bulk lane may still queue
+// Frames on the bus, oldest at jobTail (advanced by the ISR). One spare
+// entry so a full ring never looks empty.
+#define JOB_RING (FLUSH_QUEUE_DEPTH + 1)
+static bool              jobBulk[JOB_RING];    // lane of each queued frame
+static int64_t           jobSince[JOB_RING];   // urgent frames: when display() first asked
+static uint8_t           jobHead = 0, jobTail = 0;
+static SemaphoreHandle_t frameLock  = nullptr;   // guards pending frames + dirty mask
+static TaskHandle_t      flushTask  = nullptr;
+
+// pendingFrames: latest display() per screen, not yet on the bus.
+// shownFrames:   what each panel holds, only touched by the flush task.
+static uint8_t  *pendingFrames = nullptr;
+static uint8_t  *shownFrames   = nullptr;
+static bool      pendingInvert[MAX_SCREENS] = {};
+static bool      shownInvert[MAX_SCREENS]   = {};
+static uint8_t   shownLevel[MAX_SCREENS];        // oledLevel each panel last got
+static uint32_t  dirtyMask  = 0;                 // screens with a pending frame
+static uint32_t  urgentMask = 0;                 // dirty screens whose frame is urgent
+static int64_t   urgentSince[MAX_SCREENS];       // oldest urgent display() folded into the pending frame
+static uint32_t  shownValid = 0;                 // screens whose shownFrames is trusted
+static uint8_t   flushCursor = 0;                // round-robin start point
+static uint8_t   busMux = 0xFF;                  // mux left open by the last queued job
+static const uint8_t muxOff = 0;
+
+static bool IRAM_ATTR onFlushDone(i2c_master_dev_handle_t, const i2c_master_event_data_t*, void*) {
+  BaseType_t woken = pdFALSE;
+  busDoneUs = esp_timer_get_time();
+  bool bulk = jobBulk[jobTail];
+  jobTail = (jobTail + 1) % JOB_RING;
+  xSemaphoreGiveFromISR(flushSlots, &woken);
+  if (!bulk) urgentDoneUs = busDoneUs;
+  if (bulk) {
+    xSemaphoreGiveFromISR(bulkSlots, &woken);
+    vTaskNotifyGiveFromISR(flushTask, &woken);   // a held-back name render may go now
+  }
+  return woken == pdTRUE;
+}
+
+// Queue the next dirty screen: urgent ones first, then round-robin after
+// the cursor. Redraws of a screen that is still waiting simply replace its
+// pending frame, so a screen being hammered costs one transfer per turn and
+// every other dirty screen gets its turn first. Only the page range that
+// differs from the panel is sent. Returns false when there is nothing it
+// may queue right now.
+static bool flushNextDirty() {
+  if (!dirtyMask) return false;
+  // Bulk frames wait for a bulk slot; its release notifies this task
+  bool bulk = !(dirtyMask & urgentMask);
+  if (bulk && xSemaphoreTake(bulkSlots, 0) != pdTRUE) return false;
+  xSemaphoreTake(flushSlots, portMAX_DELAY);
+
+  FlushJob &job = flushJobs[flushHead];
+  uint8_t *px = job.tx + FRAME_HDR;
+  int screen = -1;
+  bool inv = false;
+
+  xSemaphoreTake(frameLock, portMAX_DELAY);
+  uint32_t pick = (dirtyMask & urgentMask) ? (dirtyMask & urgentMask) : dirtyMask;
+  for (int n = 0; n < numScreens; n++) {
+    int s = (flushCursor + n) % numScreens;
+    if (pick & (1UL << s)) { screen = s; break; }
+  }
+  int64_t since = 0;
+  if (screen >= 0) {
+    if (urgentMask & (1UL << screen)) {
+      if (bulk) { xSemaphoreGive(bulkSlots); bulk = false; }   // became urgent meanwhile
+      since = urgentSince[screen];
+    }
+    dirtyMask  &= ~(1UL << screen);
+    urgentMask &= ~(1UL << screen);
+    memcpy(px, pendingFrames + screen * FRAME_BYTES, FRAME_BYTES);
+    inv = pendingInvert[screen];
+  }
+  xSemaphoreGive(frameLock);
+
+  if (screen < 0) {
+    xSemaphoreGive(flushSlots);
+    if (bulk) xSemaphoreGive(bulkSlots);
+    return false;
+  }
+
+  uint8_t *shown = shownFrames + screen * FRAME_BYTES;
+  uint8_t level = oledLevel;
+  bool valid = shownValid & (1UL << screen);
+  bool sendInv   = !valid || inv != shownInvert[screen];
+  bool sendLevel = !valid || level != shownLevel[screen];
+  int p0 = 0, p1 = SCREEN_HEIGHT / 8 - 1;
+  if (valid) {
+    while (p0 <= p1 && !memcmp(px + p0 * PAGE_BYTES, shown + p0 * PAGE_BYTES, PAGE_BYTES)) p0++;
+    while (p1 >= p0 && !memcmp(px + p1 * PAGE_BYTES, shown + p1 * PAGE_BYTES, PAGE_BYTES)) p1--;
+    if (p0 > p1 && !sendInv && !sendLevel) {
+      xSemaphoreGive(flushSlots);
+      if (bulk) xSemaphoreGive(bulkSlots);
+      if (bulk) flushCursor = (screen + 1) % numScreens;
+      return true;
+    }
+  }
+  bool pixels = p0 <= p1;   // false: a command-only job (invert or wake/dim/sleep)
+  if (bulk && pixels && p1 - p0 >= FLUSH_BULK_PAGES) {
+    // Send the first pages now and leave the screen dirty with its turn
+    // kept: the shadow diff finds the rest next time round
+    p1 = p0 + FLUSH_BULK_PAGES - 1;
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    dirtyMask |= 1UL << screen;
+    xSemaphoreGive(frameLock);
+  } else if (bulk) {
+    flushCursor = (screen + 1) % numScreens;   // urgent frames don't move the bulk turn
+  }
+
+  uint8_t cmds[10];
+  int nc = 0;
+  if (sendInv) cmds[nc++] = inv ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY;
+  if (sendLevel && level) {
+    cmds[nc++] = SSD1306_SETCONTRAST; cmds[nc++] = level;
+    cmds[nc++] = SSD1306_DISPLAYON;
+  } else if (sendLevel) {
+    cmds[nc++] = SSD1306_DISPLAYOFF;
+  }
+  size_t npx = pixels ? (p1 - p0 + 1) * PAGE_BYTES : 0;
+  if (pixels) {
+    const uint8_t win[] = { SSD1306_PAGEADDR, (uint8_t)p0, (uint8_t)p1,
+                            SSD1306_COLUMNADDR, 0x00, SCREEN_WIDTH - 1 };
+    memcpy(cmds + nc, win, sizeof(win));
+    nc += sizeof(win);
+  }
+  uint8_t *tx = px;
+  if (pixels) *--tx = 0x40;
+  for (int i = nc - 1; i >= 0; i--) { *--tx = cmds[i]; *--tx = 0x80; }
+  if (pixels) {
+    if (p0 > 0) memmove(px, px + p0 * PAGE_BYTES, npx);
+    memcpy(shown + p0 * PAGE_BYTES, px, npx);
+  }
+  size_t len = (px - tx) + npx;
+  flushHead = (flushHead + 1) % FLUSH_QUEUE_DEPTH;
+
+  // Transactions run in submission order: close the old mux, open the
+  // channel, then the frame lands on the only 0x3C panel visible
+  uint8_t mux = screen / 8;
+  job.sel = 1 << (screen % 8);
+  esp_err_t err = ESP_OK;
+  size_t wire = (len + 1) + 2;
+  if (busMux != mux && busMux < muxCount) {
+    err = i2c_master_transmit(tcaDev[busMux], &muxOff, 1, -1);
+    wire += 2;
+  }
+  if (err == ESP_OK) err = i2c_master_transmit(tcaDev[mux], &job.sel, 1, -1);
+  if (err == ESP_OK) {
+    jobBulk[jobHead]  = bulk;   // read by the ISR when this frame completes
+    jobSince[jobHead] = since;
+    err = i2c_master_transmit(oledDev, tx, len, -1);
+    if (err == ESP_OK) jobHead = (jobHead + 1) % JOB_RING;
+  }
+  if (err != ESP_OK) {
+    xSemaphoreGive(flushSlots);
+    if (bulk) xSemaphoreGive(bulkSlots);
+    shownValid &= ~(1UL << screen);   // panel state unknown: next frame goes out whole
+    busMux = 0xFF;
+    Serial.printf("I2C: flush enqueue failed on screen %d\n", screen);
+    return true;
+  }
+  busMux = mux;
+  busFrames++;
+  busBytes += wire;
+  shownValid |= 1UL << screen;
+  shownInvert[screen] = inv;
+  shownLevel[screen]  = level;
+  return true;
+}
+
+static void oledFlushTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);   // display() marked a screen dirty, or a bulk slot freed
+    while (flushNextDirty()) {}
+  }
+}
+#endif
+
+// Hand the I2C peripheral from Wire (used by display.begin()) to the queued
+// IDF master driver. If the bus can't be created Wire stays in charge.
+void oledBusBegin() {
+#if defined(HAVE_ASYNC_I2C)
+  Wire.end();
+
+  i2c_master_bus_config_t busCfg = {};
+  busCfg.i2c_port          = I2C_NUM_0;
+  busCfg.sda_io_num        = (gpio_num_t)SDA;
+  busCfg.scl_io_num        = (gpio_num_t)SCL;
+  busCfg.clk_source        = I2C_CLK_SRC_DEFAULT;
+  busCfg.glitch_ignore_cnt = 7;
+  busCfg.trans_queue_depth = FLUSH_QUEUE_DEPTH * 3;  // deselect + select + frame per job
+  busCfg.flags.enable_internal_pullup = true;
+
+  i2c_device_config_t devCfg = {};
+  devCfg.dev_addr_length = I2C_ADDR_BIT_LEN_7;
+  devCfg.scl_speed_hz    = OLED_I2C_HZ;
+
+  esp_err_t err = i2c_new_master_bus(&busCfg, &oledBus);
+  for (uint8_t m = 0; m < muxCount && err == ESP_OK; m++) {
+    devCfg.device_address = TCA_ADDRESS + m;
+    err = i2c_master_bus_add_device(oledBus, &devCfg, &tcaDev[m]);
+  }
+  if (err == ESP_OK) {
+    devCfg.device_address = I2C_ADDR;
+    err = i2c_master_bus_add_device(oledBus, &devCfg, &oledDev);
+  }
+  if (err == ESP_OK) {
+    pendingFrames = (uint8_t*)malloc(numScreens * FRAME_BYTES);
+    shownFrames   = (uint8_t*)malloc(numScreens * FRAME_BYTES);
+    flushSlots    = xSemaphoreCreateCounting(FLUSH_QUEUE_DEPTH, FLUSH_QUEUE_DEPTH);
+    bulkSlots     = xSemaphoreCreateCounting(FLUSH_BULK_DEPTH, FLUSH_BULK_DEPTH);
+    frameLock     = xSemaphoreCreateMutex();
+    if (!pendingFrames || !shownFrames || !flushSlots || !bulkSlots || !frameLock) err = ESP_ERR_NO_MEM;
+  }
+  if (err == ESP_OK) {
+    i2c_master_event_callbacks_t cbs = {};
+    cbs.on_trans_done = onFlushDone;
+    err = i2c_master_register_event_callbacks(oledDev, &cbs, nullptr);
+  }
+  if (err == ESP_OK && xTaskCreate(oledFlushTask, "oledFlush", 3072, nullptr, 2, &flushTask) != pdPASS) {
+    err = ESP_ERR_NO_MEM;
+  }
+  if (err != ESP_OK) {
+    Serial.printf("I2C: async flush unavailable (%s), using Wire\n", esp_err_to_name(err));
+    if (oledBus) { i2c_del_master_bus(oledBus); oledBus = nullptr; }
+    free(pendingFrames); pendingFrames = nullptr;
+    free(shownFrames);   shownFrames   = nullptr;
+    Wire.begin();
+    Wire.setClock(400000);
+    Wire.setTimeOut(15);
+    wireMux = 0xFF;
+    return;
+  }
+  oledBusReady = true;
+  Serial.printf("I2C: async flush active (%d slots, %d screens)\n", FLUSH_QUEUE_DEPTH, numScreens);
+#endif
+}
+
+void QueuedSSD1306::display() {
+#if defined(HAVE_ASYNC_I2C)
+  if (oledBusReady) {
+    // Never waits on the bus: the flush task picks the frame up on its turn
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    memcpy(pendingFrames + oledTarget * FRAME_BYTES, getBuffer(), FRAME_BYTES);
+    pendingInvert[oledTarget] = oledInverted[oledTarget];
+    if (oledUrgent && !(urgentMask & (1UL << oledTarget))) {
+      urgentMask |= 1UL << oledTarget;
+      urgentSince[oledTarget] = esp_timer_get_time();
+    }
+    dirtyMask |= 1UL << oledTarget;
+    xSemaphoreGive(frameLock);
+    xTaskNotifyGive(flushTask);
+    return;
+  }
+#endif
+  Adafruit_SSD1306::invertDisplay(oledInverted[oledTarget]);
+  Adafruit_SSD1306::display();
+  busFrames++;
+  busBytes += WIRE_FRAME_BYTES;
+  busDoneUs = esp_timer_get_time();
+  if (oledUrgent) urgentDoneUs = busDoneUs;
+}
+
+// True once every frame handed to display() has left the bus
+static bool oledBusIdle() {
+#if defined(HAVE_ASYNC_I2C)
+  if (oledBusReady) return !dirtyMask && uxSemaphoreGetCount(flushSlots) == FLUSH_QUEUE_DEPTH;
+#endif
+  return true;
+}
+
+// When the oldest urgent frame not yet off the bus was asked for (INT64_MAX
+// if none): every urgent update requested before that has reached the glass.
+static int64_t oledUrgentPendingSince() {
+  int64_t oldest = INT64_MAX;
+#if defined(HAVE_ASYNC_I2C)
+  if (oledBusReady) {
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    for (int s = 0; s < numScreens; s++) {
+      if ((dirtyMask & urgentMask & (1UL << s)) && urgentSince[s] < oldest) oldest = urgentSince[s];
+    }
+    xSemaphoreGive(frameLock);
+    for (int j = jobTail; j != jobHead; j = (j + 1) % JOB_RING) {
+      if (!jobBulk[j] && jobSince[j] < oldest) oldest = jobSince[j];
+    }
+  }
+#endif
+  return oldest;
+}
+
+void QueuedSSD1306::invertDisplay(bool i) {
+  if (oledTarget < numScreens) oledInverted[oledTarget] = i;
+}
+
+// Contrast for every panel, 0 = display off. Queued: each screen gets a
+// command-only urgent job (a few bytes), since its picture is already in
+// panel RAM; a frame drawn right after is merged into the same job.
+void oledSetLevel(uint8_t level) {
+  if (level == oledLevel) return;
+  oledLevel = level;
+#if defined(HAVE_ASYNC_I2C)
+  if (oledBusReady) {
+    int64_t now = esp_timer_get_time();
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    for (int s = 0; s < numScreens; s++) {
+      if (!(shownValid & (1UL << s))) continue;   // never drawn: its first frame carries the level
+      if (!(urgentMask & (1UL << s))) urgentSince[s] = now;
+      dirtyMask  |= 1UL << s;
+      urgentMask |= 1UL << s;
+    }
+    xSemaphoreGive(frameLock);
+    xTaskNotifyGive(flushTask);
+    return;
+  }
+#endif
+  for (uint8_t s = 0; s < numScreens; s++) {
+    tcaSelect(s);
+    if (level) {
+      display.ssd1306_command(SSD1306_SETCONTRAST);
+      display.ssd1306_command(level);
+      display.ssd1306_command(SSD1306_DISPLAYON);
+    } else {
+      display.ssd1306_command(SSD1306_DISPLAYOFF);
+    }
+    busBytes += level ? 9 : 3;         // one 3-byte transaction per command
+  }
+  busDoneUs = urgentDoneUs = esp_timer_get_time();
+}
+
 void tcaSelect(uint8_t i) {
-  if (i > 7) return;
-  Wire.beginTransmission(TCA_ADDRESS);
-  Wire.write(1 << i);
+  if (i >= numScreens) return;
+  oledTarget = i;
+  if (oledBusReady) return;   // queued frames carry their own mux/channel select
+  uint8_t mux = i / 8;
+  if (wireMux != mux && wireMux < muxCount) {
+    Wire.beginTransmission(TCA_ADDRESS + wireMux);
+    Wire.write(0);
+    Wire.endTransmission(true);
+    busBytes += 2;
+  }
+  wireMux = mux;
+  Wire.beginTransmission(TCA_ADDRESS + mux);
+  Wire.write(1 << (i % 8));
   Wire.endTransmission(true);
+  busBytes += 2;
 }
 
 // measure width at given text size
@@ -738,7 +1331,124 @@ static uint16_t textWidth(const String& s, uint8_t ts) {
   return w;
 }
 
+// ---- UTF-8 track names ----
+// Names arrive as UTF-8 and are laid out in codepoints. ASCII-only names
+// go through the GFX font as before; a name with anything else is drawn
+// entirely from the utf8_glyphs.h store, so a line never mixes two
+// typefaces, and codepoints the store lacks (CJK, emoji) show as a box.
+// Every glyph keeps the classic 6x8 cell, so a line is n * 6 * size wide.
+// A stored glyph is expanded once per (codepoint, size) into page-ready
+// columns and kept in a small LRU cache; drawing it again is an OR of a
+// few bytes per column into the buffer, cheaper than GFX's drawChar().
+#define NAME_CP_MAX        64    // two lines at size 1 need 40
+#define GLYPH_CACHE_SLOTS  96
+#define GLYPH_MAX_SIZE     2     // text sizes drawTrackName() uses
+#define GLYPH_REPLACEMENT  0xFFFD
+
+// Next codepoint of a UTF-8 string; malformed or truncated sequences give
+// U+FFFD and resync on the following byte
+static uint32_t utf8Next(const char*& p) {
+  uint8_t c = (uint8_t)*p++;
+  if (c < 0x80) return c;
+  int n = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : -1;
+  if (n < 0 || c > 0xF4) return GLYPH_REPLACEMENT;
+  uint32_t cp = c & (0x3F >> n);
+  for (int i = 0; i < n; i++) {
+    if (((uint8_t)*p & 0xC0) != 0x80) return GLYPH_REPLACEMENT;
+    cp = (cp << 6) | ((uint8_t)*p++ & 0x3F);
+  }
+  return cp;
+}
+
+// Decode a name for layout: whitespace and control characters collapse to
+// single spaces, ends trimmed; ascii is false if anything needs the store
+static int nameCodepoints(const String& name, uint16_t* out, bool& ascii) {
+  int n = 0;
+  ascii = true;
+  const char* p = name.c_str();
+  while (*p && n < NAME_CP_MAX) {
+    uint32_t cp = utf8Next(p);
+    if (cp <= ' ' || cp == 0x7F || cp == 0xA0) {
+      if (n && out[n - 1] != ' ') out[n++] = ' ';
+      continue;
+    }
+    if (cp > 0xFFFF) cp = GLYPH_REPLACEMENT;
+    if (cp >= 0x80) ascii = false;
+    out[n++] = (uint16_t)cp;
+  }
+  while (n && out[n - 1] == ' ') n--;
+  return n;
+}
+
+#if HAVE_UTF8_GLYPHS
+struct GlyphSlot {
+  uint32_t used;                                  // LRU stamp, 0 = empty
+  uint16_t cp;
+  uint8_t  size;
+  uint16_t cols[UTF8_GLYPH_W * GLYPH_MAX_SIZE];   // bit n = row n from the top
+};
+static GlyphSlot glyphCache[GLYPH_CACHE_SLOTS];
+static uint32_t  glyphClock = 0, glyphHits = 0, glyphMisses = 0;
+
+static const uint8_t* glyphRows(uint16_t cp) {
+  int lo = 0, hi = UTF8_GLYPH_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    uint16_t c = pgm_read_word(&UTF8_GLYPHS[mid].cp);
+    if (c == cp) return UTF8_GLYPHS[mid].rows;
+    if (c < cp) lo = mid + 1; else hi = mid - 1;
+  }
+  return cp == GLYPH_REPLACEMENT ? UTF8_GLYPHS[0].rows : glyphRows(GLYPH_REPLACEMENT);
+}
+
+static const GlyphSlot& glyphFor(uint16_t cp, uint8_t size) {
+  GlyphSlot* victim = &glyphCache[0];
+  for (GlyphSlot& s : glyphCache) {
+    if (s.used && s.cp == cp && s.size == size) {
+      s.used = ++glyphClock;
+      glyphHits++;
+      return s;
+    }
+    if (s.used < victim->used) victim = &s;
+  }
+  glyphMisses++;
+  const uint8_t* rows = glyphRows(cp);
+  const uint16_t px = (1u << size) - 1;
+  for (int c = 0; c < UTF8_GLYPH_W; c++) {
+    uint16_t col = 0;
+    for (int r = 0; r < UTF8_GLYPH_H; r++)
+      if (pgm_read_byte(&rows[r]) & (0x80 >> c)) col |= px << (r * size);
+    for (int d = 0; d < size; d++) victim->cols[c * size + d] = col;
+  }
+  victim->cp = cp;
+  victim->size = size;
+  victim->used = ++glyphClock;
+  return *victim;
+}
+
+// OR a cached glyph into the page-major buffer; a column spans up to 3 pages
+static void blitGlyph(const GlyphSlot& g, int x, int y) {
+  uint8_t* buf = display.getBuffer();
+  const int page = y >> 3, shift = y & 7;
+  for (int i = 0; i < UTF8_GLYPH_W * g.size; i++) {
+    int cx = x + i;
+    if (cx < 0 || cx >= SCREEN_WIDTH) continue;
+    uint32_t bits = (uint32_t)g.cols[i] << shift;
+    for (int p = page; bits && p < SCREEN_HEIGHT / 8; p++, bits >>= 8)
+      if (p >= 0) buf[p * SCREEN_WIDTH + cx] |= (uint8_t)bits;
+  }
+}
+#endif
+
+static void drawCodepoint(uint16_t cp, int x, int y, uint8_t ts, bool viaGfx) {
+#if HAVE_UTF8_GLYPHS
+  if (!viaGfx && ts <= GLYPH_MAX_SIZE) { blitGlyph(glyphFor(cp, ts), x, y); return; }
+#endif
+  display.drawChar(x, y, cp < 0x80 ? (uint8_t)cp : '?', SSD1306_WHITE, SSD1306_WHITE, ts);
+}
+
 void drawTrackName(uint8_t screen, const String& name) {
+  animFinish();
   tcaSelect(screen);
   display.invertDisplay(screen == activeTrack);
   display.clearDisplay();
@@ -748,94 +1458,89 @@ void drawTrackName(uint8_t screen, const String& name) {
   // Border
   display.drawRect(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, SSD1306_WHITE);
 
-  String raw = name; raw.trim();
+  uint16_t cps[NAME_CP_MAX];
+  bool ascii;
+  int n = nameCodepoints(name, cps, ascii);
 
   const int MARGIN = 3, GAP = 2, maxW = SCREEN_WIDTH - 2 * MARGIN;
   const int CHAR_H = 8, CHAR_W = 6;
 
-  auto _textWidth = [&](const String& s, uint8_t ts)->uint16_t{
-    int16_t x1,y1; uint16_t w,h; display.setTextSize(ts);
-    display.getTextBounds(s,0,0,&x1,&y1,&w,&h); return w;
+  // A line is cps[at, at + len), followed by "..." when it was cut short
+  struct Line { int at, len; bool cut; };
+  auto lineWidth = [&](const Line& l, uint8_t ts)->int{
+    return (l.len + (l.cut ? 3 : 0)) * CHAR_W * ts;
   };
-  auto drawSingleLine = [&](const String& line, uint8_t ts){
-    display.setTextSize(ts);
-    int w = _textWidth(line, ts);
-    int lineH = CHAR_H * ts;
-    int x = MARGIN + (maxW - w) / 2;
-    int y = (SCREEN_HEIGHT - lineH) / 2;
-    display.setCursor(x, y);
-    display.println(line);
+  auto drawLine = [&](const Line& l, uint8_t ts, int y){
+    int x = MARGIN + (maxW - lineWidth(l, ts)) / 2;
+    for (int i = 0; i < l.len; i++, x += CHAR_W * ts) drawCodepoint(cps[l.at + i], x, y, ts, ascii);
+    for (int i = 0; l.cut && i < 3; i++, x += CHAR_W * ts) drawCodepoint('.', x, y, ts, ascii);
   };
-  auto drawTwoLines = [&](const String& l1, const String& l2, uint8_t ts){
-    display.setTextSize(ts);
-    int w1 = _textWidth(l1, ts), w2 = _textWidth(l2, ts);
+  auto drawSingleLine = [&](const Line& l, uint8_t ts){
+    drawLine(l, ts, (SCREEN_HEIGHT - CHAR_H * ts) / 2);
+  };
+  auto drawTwoLines = [&](const Line& l1, const Line& l2, uint8_t ts){
     int lineH = CHAR_H * ts, totalH = lineH * 2 + GAP;
     int y0 = (SCREEN_HEIGHT - totalH) / 2;
-    int x1 = MARGIN + (maxW - w1) / 2;
-    display.setCursor(x1, y0); display.println(l1);
-    int x2 = MARGIN + (maxW - w2) / 2;
-    display.setCursor(x2, y0 + lineH + GAP); display.println(l2);
+    drawLine(l1, ts, y0);
+    drawLine(l2, ts, y0 + lineH + GAP);
   };
-  auto trimToWidth = [&](String &line, uint8_t ts){
+  auto trimToWidth = [&](Line &line, uint8_t ts){
     int maxChars = max(1, maxW / (CHAR_W * ts));
-    if ((int)line.length() > maxChars) {
-      if (maxChars >= 3) line = line.substring(0, maxChars - 3) + "...";
-      else               line = line.substring(0, maxChars);
+    if (line.len > maxChars) {
+      if (maxChars >= 3) { line.len = maxChars - 3; line.cut = true; }
+      else               line.len = maxChars;
     }
   };
+  auto trimSpaces = [&](Line &line){
+    while (line.len && cps[line.at] == ' ') { line.at++; line.len--; }
+    while (line.len && cps[line.at + line.len - 1] == ' ') line.len--;
+  };
 
-  if (raw.length()) {
-    // normalize spaces
-    String s; s.reserve(raw.length()); bool lastSpace = false;
-    for (size_t i=0;i<raw.length();++i){ char c=raw[i];
-      if (c==' '||c=='\t'){ if(!lastSpace){ s+=' '; lastSpace=true; } }
-      else { s+=c; lastSpace=false; } }
-    while (s.length() && s[0]==' ') s.remove(0,1);
-    while (s.length() && s[s.length()-1]==' ') s.remove(s.length()-1);
-
+  if (n) {
+    const Line all = { 0, n, false };
     bool drawn=false;
     // Try text size 2, then 1
     for (uint8_t ts : { (uint8_t)2, (uint8_t)1 }) {
       // First try: fit everything on one line
-      if (_textWidth(s, ts) <= maxW) {
-        drawSingleLine(s, ts);
+      if (lineWidth(all, ts) <= maxW) {
+        drawSingleLine(all, ts);
         drawn=true;
         break;
       }
-      
+
       // Second try: split into two lines by character count, prefer space break
       int maxChars = max(1, maxW/(CHAR_W*ts));
-      if ((int)s.length() <= maxChars * 2) {
+      if (n <= maxChars * 2) {
         // Find best break point (prefer space near middle)
-        int idealBreak = s.length() / 2;
+        int idealBreak = n / 2;
         int breakPoint = idealBreak;
-        
-        // Look for space within Â±3 chars of ideal break
-        for (int offset = 0; offset <= 3 && idealBreak + offset < (int)s.length(); offset++) {
-          if (s[idealBreak + offset] == ' ') { breakPoint = idealBreak + offset; break; }
-          if (idealBreak - offset >= 0 && s[idealBreak - offset] == ' ') { breakPoint = idealBreak - offset; break; }
+
+        // Look for space within +/-3 chars of ideal break
+        for (int offset = 0; offset <= 3 && idealBreak + offset < n; offset++) {
+          if (cps[idealBreak + offset] == ' ') { breakPoint = idealBreak + offset; break; }
+          if (idealBreak - offset >= 0 && cps[idealBreak - offset] == ' ') { breakPoint = idealBreak - offset; break; }
         }
-        
-        String l1 = s.substring(0, breakPoint);
-        String l2 = s.substring(breakPoint);
-        l1.trim(); l2.trim();
-        
+
+        Line l1 = { 0, breakPoint, false };
+        Line l2 = { breakPoint, n - breakPoint, false };
+        trimSpaces(l1); trimSpaces(l2);
+
         // Truncate if still too long
         trimToWidth(l1, ts);
         trimToWidth(l2, ts);
-        
-        if (_textWidth(l1, ts) <= maxW && _textWidth(l2, ts) <= maxW) {
+
+        if (lineWidth(l1, ts) <= maxW && lineWidth(l2, ts) <= maxW) {
           drawTwoLines(l1, l2, ts);
           drawn=true;
           break;
         }
       }
     }
-    
+
     // Fallback: truncate to one line at size 1
     if (!drawn) {
       uint8_t ts=1;
-      String l=s;
+      Line l = all;
       trimToWidth(l, ts);
       drawSingleLine(l, ts);
     }
@@ -857,9 +1562,40 @@ void drawTrackName(uint8_t screen, const String& name) {
 }
 
 void refreshAll() {
+  nameDirty = 0;
   for (uint8_t i = 0; i < numScreens; i++) drawTrackName(i, trackNames[i]);
 } // Redraw all screens with their current track names
 
+// Bulk lane: trackNames[screen] is already current, draw it when loop() gets there
+void queueNameRender(uint8_t screen) {
+  if (screen < numScreens) nameDirty |= 1UL << screen;
+}
+
+// Urgent lane: draw now and put the frame ahead of queued name renders
+void drawTrackNameUrgent(uint8_t screen) {
+  if (screen >= numScreens) return;
+  oledUrgent = true;
+  drawTrackName(screen, trackNames[screen]);
+  oledUrgent = false;
+  nameDirty &= ~(1UL << screen);
+}
+
+// Draw one pending name render; true if there was one
+bool serviceNameRenders() {
+  if (!nameDirty) return false;
+  for (int n = 0; n < numScreens; n++) {
+    uint8_t s = (nameCursor + n) % numScreens;
+    if (nameDirty & (1UL << s)) {
+      nameDirty &= ~(1UL << s);
+      nameCursor = (s + 1) % numScreens;
+      drawTrackName(s, trackNames[s]);
+      return true;
+    }
+  }
+  nameDirty = 0;   // only bits past numScreens were left
+  return false;
+}
+
 void drawCentered(const String& s, uint8_t textSize, int y) {
   display.setTextSize(textSize);
   display.setTextColor(SSD1306_WHITE);
@@ -879,11 +1615,11 @@ void drawLines(uint8_t ts, int y0, const char* l1, const char* l2, const char* l
   if (l3){ drawCentered(String(l3), ts, y); }
 }
 
-// =====================  Demo film mode loop  ===================
-#if DEMO_FILM_MODE
-static uint32_t demoDiagFrame = 0;
-
-static void demoAnimRects(uint8_t ch, uint32_t f) {
+// =====================  Diagnostic patterns  ===================
+// The OLED_Diagnostic sketch's per-channel animations. Every frame redraws
+// every pixel region, so they double as a full-frame load for BENCH anim
+// and the demo film intro.
+static void diagAnimRects(uint8_t ch, uint32_t f) {
   int w = 16 + ((f / 3 + ch * 7) % 96);
   int h = 8 + ((f / 2 + ch * 5) % 48);
   int x = (f + ch * 9) % (SCREEN_WIDTH - w);
@@ -892,7 +1628,7 @@ static void demoAnimRects(uint8_t ch, uint32_t f) {
   display.drawRect(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, SSD1306_WHITE);
 }
 
-static void demoAnimLines(uint8_t ch, uint32_t f) {
+static void diagAnimLines(uint8_t ch, uint32_t f) {
   int y1 = (f + ch * 3) % SCREEN_HEIGHT;
   int y2 = (SCREEN_HEIGHT - 1) - ((f / 2 + ch * 7) % SCREEN_HEIGHT);
   display.drawLine(0, y1, SCREEN_WIDTH - 1, y2, SSD1306_WHITE);
@@ -901,13 +1637,13 @@ static void demoAnimLines(uint8_t ch, uint32_t f) {
   display.drawLine(x1, 0, x2, SCREEN_HEIGHT - 1, SSD1306_WHITE);
 }
 
-static void demoAnimCircles(uint8_t ch, uint32_t f) {
+static void diagAnimCircles(uint8_t ch, uint32_t f) {
   int r = 4 + ((f / 3 + ch * 2) % 28);
   display.drawCircle(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, r, SSD1306_WHITE);
   display.drawCircle((f / 2 + ch * 9) % SCREEN_WIDTH, (f / 3 + ch * 5) % SCREEN_HEIGHT, 6, SSD1306_WHITE);
 }
 
-static void demoAnimChecker(uint8_t ch, uint32_t f) {
+static void diagAnimChecker(uint8_t ch, uint32_t f) {
   int s = 8;
   int ox = (f / 3 + ch * 2) % s;
   int oy = (f / 5 + ch * 3) % s;
@@ -919,21 +1655,31 @@ static void demoAnimChecker(uint8_t ch, uint32_t f) {
   }
 }
 
-static void demoRunDiagnosticsFrame() {
-  demoDiagFrame++;
+// One animation frame on every screen
+static void diagDrawFrame(uint32_t f) {
   for (uint8_t ch = 0; ch < numScreens; ch++) {
     tcaSelect(ch);
+    display.invertDisplay(false);
     display.clearDisplay();
     switch (ch % 4) {
-      case 0: demoAnimRects(ch, demoDiagFrame);   break;
-      case 1: demoAnimLines(ch, demoDiagFrame);   break;
-      case 2: demoAnimCircles(ch, demoDiagFrame); break;
-      case 3: demoAnimChecker(ch, demoDiagFrame); break;
+      case 0: diagAnimRects(ch, f);   break;
+      case 1: diagAnimLines(ch, f);   break;
+      case 2: diagAnimCircles(ch, f); break;
+      case 3: diagAnimChecker(ch, f); break;
     }
     display.display();
   }
 }
 
+// =====================  Demo film mode loop  ===================
+#if DEMO_FILM_MODE
+static uint32_t demoDiagFrame = 0;
+
+static void demoRunDiagnosticsFrame() {
+  demoDiagFrame++;
+  diagDrawFrame(demoDiagFrame);
+}
+
 void loopDemo() {
   unsigned long now = millis();
 
@@ -1031,6 +1777,7 @@ void showNetworkSetup() {
 }
 
 void showNetworkSplash(const String& ip) {
+  animFinish();
   // OLED 1 (index 0): Show ONLINE + IP
   tcaSelect(0);
   display.invertDisplay(false);
@@ -1068,20 +1815,39 @@ void showNetworkSplash(const String& ip) {
   drawCentered("IP: " + ip, 1, 36);
   display.display();
 
-  // OLED 8 (index 7): PlayOptix logo only
-  tcaSelect(7);
+  // Last OLED: PlayOptix logo only
+  tcaSelect(numScreens - 1);
   display.invertDisplay(false);
   display.clearDisplay();
   display.display();
   delay(10);
   display.setTextWrap(false);
   display.setTextColor(SSD1306_WHITE);
-  display.drawBitmap(0, 0, playoptix_logo, LOGO_WIDTH, LOGO_HEIGHT, SSD1306_WHITE);
-  display.fillRect(0, 54, 128, 10, SSD1306_BLACK);
+  blitPackBits(PLAYOPTIX_BITMAP_RLE);
   display.display();
 }
 
+// Firmware update progress, same picture on every panel
+void showUpdateProgress(int pct) {
+  animFinish();
+  oledUrgent = true;
+  for (uint8_t i = 0; i < numScreens; i++) {
+    tcaSelect(i);
+    display.invertDisplay(false);
+    display.clearDisplay();
+    display.setTextWrap(false);
+    display.setTextColor(SSD1306_WHITE);
+    drawCentered("UPDATING", 1, 12);
+    display.drawRect(10, 28, SCREEN_WIDTH - 20, 10, SSD1306_WHITE);
+    display.fillRect(12, 30, (SCREEN_WIDTH - 24) * pct / 100, 6, SSD1306_WHITE);
+    drawCentered(String(pct) + "%", 1, 44);
+    display.display();
+  }
+  oledUrgent = false;
+}
+
 void showAbletonConnectedAll(uint16_t ms) {
+  animFinish();
   // Show Ableton Connected only on OLED 1 (index 0)
   tcaSelect(0);
   display.invertDisplay(false);
@@ -1144,7 +1910,7 @@ void handleTrackName(OSCMessage &msg) {
     }
     trackNames[idx] = incoming;
     actualTrackNumbers[idx] = actualTrack;
-    drawTrackName(idx, trackNames[idx]);
+    queueNameRender(idx);
     Serial.printf("RECV: /trackname %d '%s'\n", idx, buf);
   }
 }
@@ -1156,15 +1922,15 @@ void handleActiveTrack(OSCMessage &msg) {
   if (idx == -1) {
     int old = activeTrack;
     activeTrack = -1;
-    if (old >= 0) drawTrackName(old, trackNames[old]);
+    if (old >= 0) drawTrackNameUrgent(old);
     Serial.println("RECV: /activetrack -1 (clear)");
     return;
   }
   if (idx < 0 || idx >= numScreens || idx == activeTrack) return;
   int old = activeTrack;
   activeTrack = idx;
-  if (old >= 0) drawTrackName(old, trackNames[old]);
-  drawTrackName(activeTrack, trackNames[activeTrack]);
+  if (old >= 0) drawTrackNameUrgent(old);
+  drawTrackNameUrgent(activeTrack);
   Serial.printf("RECV: /activetrack %d\n", idx);
 }
 
@@ -1180,14 +1946,11 @@ void handleHi(OSCMessage &msg) {
 }
 
 void sendHelloToM4L() {
-  // Send /hello to M4L on port 9000 (broadcast)
+  // Send /hello to M4L on port 9000 (unicast to the peer, else broadcast)
   if (WiFi.status() != WL_CONNECTED) return;
   
-  IPAddress gw = WiFi.gatewayIP();
-  IPAddress bcast(gw[0], gw[1], gw[2], 255);
-  
   OSCMessage msg("/hello");
-  Udp.beginPacket(bcast, 9000);
+  Udp.beginPacket(oscTarget(), 9000);
   msg.send(Udp);
   Udp.endPacket();
   
@@ -1369,7 +2132,7 @@ let names = Array(8).fill('');
 
 function renderTracks(){
   tgrid.innerHTML = '';
-  for(let i=0;i<8;i++){
+  for(let i=0;i<names.length;i++){
     const card = document.createElement('div'); card.className='trackCard';
     const h = document.createElement('h3'); h.textContent = `Track ${i+0}`;
     const inp = document.createElement('input'); inp.className='input'; inp.id='name'+i; inp.value = names[i] || `Track ${i+0}`;
@@ -1382,7 +2145,7 @@ async function loadTracks(){
   try{
     const r = await fetch('/tracks', { cache: 'no-store' });
     const j = await r.json();
-    names = Array.isArray(j.names) && j.names.length===8 ? j.names : names;
+    names = Array.isArray(j.names) && j.names.length ? j.names : names;
   }catch(e){}
   renderTracks();
 }
@@ -1390,7 +2153,7 @@ F('reloadNames').onclick = loadTracks;
 
 F('saveNames').onclick = async ()=>{
   const out = [];
-  for(let i=0;i<8;i++){ out.push(document.getElementById('name'+i).value); }
+  for(let i=0;i<names.length;i++){ out.push(document.getElementById('name'+i).value); }
   tmsg.textContent = 'Saving...';
   const res = await post('/tracks',{names:out});
   tmsg.textContent = res.includes('"ok"') ? 'Names saved & pushed to displays.' : 'Save failed.';
@@ -1568,7 +2331,7 @@ void handleWifiSave() {
 
 // ---------- Tracks endpoints + persistence ----------
 void handleTracksGet() {
-  DynamicJsonDocument doc(1024);
+  DynamicJsonDocument doc(4096);   // room for MAX_SCREENS names
   JsonArray namesArr = doc.createNestedArray("names");
   for (int i=0;i<numScreens;i++) namesArr.add(trackNames[i]);
   String out; serializeJson(doc, out);
@@ -1579,7 +2342,7 @@ void handleTracksGet() {
 }
 
 void handleTracksPost() {
-  DynamicJsonDocument doc(2048);
+  DynamicJsonDocument doc(4096);
   if (deserializeJson(doc, server.arg("plain"))) {
     server.send(400,"application/json","{\"result\":\"error\",\"msg\":\"bad json\"}");
     return;
@@ -1606,9 +2369,229 @@ void handleTracksReset() {
   server.send(200, "application/json", "{\"result\":\"ok\"}");
 }
 
+// ---------- OTA image writer ----------
+// Shared by the HTTP endpoint and the FWU serial commands. Bytes are pushed
+// in as they arrive and go straight into the inactive app partition. An
+// image starting with the gzip magic (1f 8b, e.g. from pack_ota.js) is
+// inflated on the fly, so the link only carries about half the bytes.
+// finish() compares the SHA-256 of what was written (the plain .bin)
+// before the partition is made bootable; on a mismatch the running image
+// stays.
+class OtaWriter {
+public:
+  bool   active   = false;
+  size_t received = 0;       // bytes fed in (compressed if gz)
+  size_t written  = 0;       // bytes flashed
+
+  bool begin() {
+    abort();
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
+      Serial.printf("OTA: %s\n", Update.errorString());
+      return false;
+    }
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+    active = true;
+    received = written = 0;
+    mode = MODE_DETECT;
+    return true;
+  }
+
+  bool feed(const uint8_t* p, size_t n) {
+    if (!active) return false;
+    received += n;
+    if (mode == MODE_DETECT && n) {
+      mode = (p[0] == 0x1f) ? MODE_GZ_HEADER : MODE_PLAIN;
+      if (mode != MODE_PLAIN && !startInflate()) return fail();
+    }
+    if (mode == MODE_PLAIN) return sink(p, n) || fail();
+    bool ok = true;
+    if (mode == MODE_GZ_HEADER) {
+      size_t used = gzipHeader(p, n, ok);
+      p += used; n -= used;
+    }
+    if (ok && mode == MODE_INFLATE && n) ok = inflate(p, n);
+    return ok || fail();
+  }
+
+  // Verifies against wantSha (lowercase hex, may be empty) and marks the
+  // partition bootable. gotSha is filled in either way.
+  bool finish(const String& wantSha, String& gotSha) {
+    if (!active) return false;
+    uint8_t d[32];
+    mbedtls_sha256_finish(&sha, d);
+    char h[65];
+    for (int i = 0; i < 32; i++) sprintf(h + 2 * i, "%02x", d[i]);
+    gotSha = h;
+    bool ok = true;
+    if (mode == MODE_GZ_HEADER || mode == MODE_INFLATE) {
+      Serial.println("OTA: gzip stream truncated");
+      ok = false;
+    }
+    if (ok && gotSha != wantSha) {
+      Serial.printf("OTA: sha256 %s, expected %s\n", h, wantSha.c_str());
+      ok = false;
+    }
+    if (!ok) { abort(); return false; }
+    release();
+    if (!Update.end(true)) {
+      Serial.printf("OTA: %s\n", Update.errorString());
+      return false;
+    }
+    return true;
+  }
+
+  void abort() {
+    if (!active) return;
+    Update.abort();
+    release();
+  }
+
+private:
+  enum Mode : uint8_t { MODE_DETECT, MODE_PLAIN, MODE_GZ_HEADER, MODE_INFLATE, MODE_DONE };
+  enum GzField : uint8_t { GZ_FIXED, GZ_XLEN, GZ_SKIP, GZ_ZSTR };
+
+  mbedtls_sha256_context sha;
+  Mode     mode = MODE_DETECT;
+  GzField  gzField = GZ_FIXED;
+  uint8_t  gzFixed[10];
+  uint8_t  gzFlags = 0;
+  uint16_t gzCount = 0;
+#if defined(HAVE_ROM_INFLATE)
+  tinfl_decompressor* inf = nullptr;
+  uint8_t* dict = nullptr;   // 32 KB wrapping output window
+  size_t   dictOfs = 0;
+#endif
+
+  bool sink(const uint8_t* p, size_t n) {
+    if (Update.write(const_cast<uint8_t*>(p), n) != n) return false;
+    mbedtls_sha256_update(&sha, p, n);
+    written += n;
+    return true;
+  }
+
+  bool fail() { abort(); return false; }
+
+  void release() {
+#if defined(HAVE_ROM_INFLATE)
+    free(inf);  inf = nullptr;
+    free(dict); dict = nullptr;
+#endif
+    mbedtls_sha256_free(&sha);
+    active = false;
+  }
+
+  bool startInflate() {
+#if defined(HAVE_ROM_INFLATE)
+    inf  = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+    dict = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+    if (!inf || !dict) { Serial.println("OTA: out of memory for inflate"); return false; }
+    tinfl_init(inf);
+    dictOfs = 0;
+    gzField = GZ_FIXED;
+    gzCount = 0;
+    return true;
+#else
+    Serial.println("OTA: no inflater in this build, send a plain .bin");
+    return false;
+#endif
+  }
+
+  // After the fixed part, optional fields follow in FLG bit order
+  void gzipNextField() {
+    if (gzFlags & 0x04) { gzFlags &= ~0x04; gzField = GZ_XLEN; gzCount = 0; return; }  // FEXTRA
+    if (gzFlags & 0x08) { gzFlags &= ~0x08; gzField = GZ_ZSTR; return; }               // FNAME
+    if (gzFlags & 0x10) { gzFlags &= ~0x10; gzField = GZ_ZSTR; return; }               // FCOMMENT
+    if (gzFlags & 0x02) { gzFlags &= ~0x02; gzField = GZ_SKIP; gzCount = 2; return; }  // FHCRC
+    mode = MODE_INFLATE;
+  }
+
+  // Consumes header bytes, returns how many were used
+  size_t gzipHeader(const uint8_t* p, size_t n, bool& ok) {
+    size_t i = 0;
+    while (i < n && mode == MODE_GZ_HEADER) {
+      uint8_t c = p[i++];
+      switch (gzField) {
+        case GZ_FIXED:
+          gzFixed[gzCount++] = c;
+          if (gzCount == sizeof(gzFixed)) {
+            if (gzFixed[1] != 0x8b || gzFixed[2] != 8) {
+              Serial.println("OTA: not a gzip/deflate image");
+              ok = false;
+              return i;
+            }
+            gzFlags = gzFixed[3];
+            gzipNextField();
+          }
+          break;
+        case GZ_XLEN:
+          gzFixed[gzCount++] = c;
+          if (gzCount == 2) {
+            gzCount = gzFixed[0] | (gzFixed[1] << 8);
+            gzField = GZ_SKIP;
+            if (!gzCount) gzipNextField();
+          }
+          break;
+        case GZ_SKIP:
+          if (--gzCount == 0) gzipNextField();
+          break;
+        case GZ_ZSTR:
+          if (!c) gzipNextField();
+          break;
+      }
+    }
+    return i;
+  }
+
+  bool inflate(const uint8_t* p, size_t n) {
+#if defined(HAVE_ROM_INFLATE)
+    for (;;) {
+      size_t inBytes  = n;
+      size_t outBytes = TINFL_LZ_DICT_SIZE - dictOfs;
+      tinfl_status st = tinfl_decompress(inf, p, &inBytes, dict, dict + dictOfs, &outBytes,
+                                         TINFL_FLAG_HAS_MORE_INPUT);
+      p += inBytes; n -= inBytes;
+      if (outBytes && !sink(dict + dictOfs, outBytes)) return false;
+      dictOfs = (dictOfs + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+      if (st == TINFL_STATUS_DONE) {
+        mode = MODE_DONE;            // CRC32/ISIZE trailer ignored: SHA-256 covers the image
+        return true;
+      }
+      if (st < 0) {
+        Serial.printf("OTA: inflate failed (%d)\n", (int)st);
+        return false;
+      }
+      if (st == TINFL_STATUS_NEEDS_MORE_INPUT && !n) return true;
+    }
+#else
+    (void)p; (void)n;
+    return false;
+#endif
+  }
+};
+
+static OtaWriter ota;
+
+// Every image must come with the SHA-256 of the plain .bin (64 lower-case
+// hex digits, as pack_ota.js writes into the manifest)
+static bool isSha256Hex(const String& s) {
+  if (s.length() != 64) return false;
+  for (size_t i = 0; i < 64; i++) {
+    char c = s[i];
+    if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) return false;
+  }
+  return true;
+}
+
 // ---------- OTA update endpoint ----------
+// The image is fetched without checking the server's certificate, so the
+// "sha256" the caller sends is what makes it trustworthy: a request without
+// one is refused, and an image that doesn't match it is never booted.
+#define OTA_CHUNK       1024
+#define OTA_TIMEOUT_MS  15000UL   // give up if the stream stalls this long
+
 void handleUpdate() {
-  // Body: {"version":"<ver>","url":"https://.../firmware.bin"}
+  // Body: {"version":"<ver>","url":"https://.../firmware.bin[.gz]","sha256":"<hex>"}
   DynamicJsonDocument doc(512);
   if (deserializeJson(doc, server.arg("plain"))) {
     server.send(400,"application/json","{\"result\":\"error\",\"msg\":\"bad json\"}");
@@ -1619,18 +2602,207 @@ void handleUpdate() {
     server.send(400,"application/json","{\"result\":\"error\",\"msg\":\"missing url\"}");
     return;
   }
+  String want = doc["sha256"] | "";
+  want.toLowerCase();
+  if (!isSha256Hex(want)) {
+    server.send(400,"application/json","{\"result\":\"error\",\"msg\":\"missing or bad sha256\"}");
+    return;
+  }
 
   server.send(200,"application/json","{\"result\":\"ok\",\"msg\":\"updating\"}");
   delay(300);
 
   WiFiClientSecure client;
-  client.setInsecure();                // accept GitHub/S3 certs without bundle
-  httpUpdate.rebootOnUpdate(true);     // auto-reboot if update succeeds
+  client.setInsecure();                // no CA bundle for GitHub/S3; the sha256 check above is the gate
+  HTTPClient http;
+  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);   // release assets redirect to S3
+  if (!http.begin(client, url)) {
+    Serial.println("OTA failed: bad url");
+    return;
+  }
+  int code = http.GET();
+  if (code != HTTP_CODE_OK) {
+    Serial.printf("OTA failed: HTTP %d\n", code);
+    http.end();
+    return;
+  }
+  if (!ota.begin()) {
+    http.end();
+    return;
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  int remaining = http.getSize();      // -1 when chunked
+  uint8_t buf[OTA_CHUNK];
+  unsigned long lastData = millis();
+  bool ok = true;
+  while (ok && remaining != 0 && millis() - lastData < OTA_TIMEOUT_MS) {
+    int avail = stream->available();
+    if (avail <= 0) {
+      if (!stream->connected()) break;
+      delay(1);
+      continue;
+    }
+    int n = stream->read(buf, min((size_t)avail, sizeof(buf)));
+    if (n <= 0) continue;
+    if (remaining > 0) remaining -= n;
+    lastData = millis();
+    ok = ota.feed(buf, n);
+  }
+  http.end();
+  if (ok && remaining > 0) {
+    Serial.printf("OTA failed: stream ended %d bytes short\n", remaining);
+    ota.abort();
+    return;
+  }
+
+  size_t wire = ota.received;
+  String got;
+  if (!ok || !ota.finish(want, got)) {
+    Serial.println("OTA failed: running image kept");
+    return;
+  }
+  Serial.printf("OTA: %u bytes received, %u written, sha256 %s verified, rebooting\n",
+                (unsigned)wire, (unsigned)ota.written, got.c_str());
+  delay(200);
+  ESP.restart();
+}
 
-  t_httpUpdate_return ret = httpUpdate.update(client, url);
-  if (ret != HTTP_UPDATE_OK) {
-    Serial.printf("OTA failed: %d %s\n", (int)ret, httpUpdate.getLastErrorString().c_str());
+// ---------- Serial firmware update (FWU) ----------
+// The same writer fed over the USB serial link, so the bridge can update a
+// running unit without resetting it into the ROM bootloader. One command
+// per line:
+//   FWU BEGIN <bytes> <sha256>      -> FWU: READY <offset> inflate=<0|1>
+//   FWU DATA <offset> <crc32> <b64> -> FWU: ACK <next> | FWU: NAK <expected>
+//   FWU END                         -> FWU: DONE <written> <sha256>, reboot
+//   FWU ABORT | FWU STATUS
+// <bytes> is the size sent (compressed if gz), <sha256> the plain image's.
+// DATA acks are cumulative, so the sender can keep a window in flight and go
+// back to <expected> after a NAK. A BEGIN repeating the current image's size
+// and hash resumes at the offset already written instead of starting over.
+#define FWU_CHUNK_MAX 768         // decoded bytes per DATA line
+
+static size_t fwuTotal = 0;
+static String fwuSha;
+static int    fwuPct = -1;
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* p, size_t n) {
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
   }
+  return ~crc;
+}
+
+static bool fwuActive() { return ota.active && fwuTotal; }
+
+static void fwuProgress() {
+  int pct = fwuTotal ? (int)((uint64_t)ota.received * 100 / fwuTotal) : 0;
+  if (pct == fwuPct) return;
+  fwuPct = pct;
+  showUpdateProgress(pct);
+}
+
+static void fwuCancel(const char* why) {
+  ota.abort();
+  fwuTotal = 0;
+  fwuPct = -1;
+  Serial.printf("ERR: FWU %s\n", why);
+  refreshAll();
+}
+
+void handleFwu(const String& args) {
+  String a = args;
+  a.trim();
+  int sp = a.indexOf(' ');
+  String sub = sp >= 0 ? a.substring(0, sp) : a;
+  String rest = sp >= 0 ? a.substring(sp + 1) : "";
+  sub.toLowerCase();
+
+  if (sub == "begin") {
+    int sp2 = rest.indexOf(' ');
+    size_t total = (size_t)rest.substring(0, sp2).toInt();
+    String sha = sp2 > 0 ? rest.substring(sp2 + 1) : "";
+    sha.trim(); sha.toLowerCase();
+    if (!total || !isSha256Hex(sha)) { Serial.println("ERR: FWU BEGIN <bytes> <sha256>"); return; }
+    if (!(fwuActive() && total == fwuTotal && sha == fwuSha)) {
+      if (!ota.begin()) { fwuTotal = 0; Serial.println("ERR: FWU cannot open update partition"); return; }
+      fwuTotal = total;
+      fwuSha = sha;
+      fwuPct = -1;
+    }
+#if defined(HAVE_ROM_INFLATE)
+    const int canInflate = 1;
+#else
+    const int canInflate = 0;
+#endif
+    Serial.printf("FWU: READY %u inflate=%d\n", (unsigned)ota.received, canInflate);
+    fwuProgress();
+    return;
+  }
+
+  if (sub == "data") {
+    if (!fwuActive()) { Serial.println("ERR: FWU no update in progress"); return; }
+    int s1 = rest.indexOf(' ');
+    int s2 = s1 > 0 ? rest.indexOf(' ', s1 + 1) : -1;
+    if (s2 < 0) { Serial.printf("FWU: NAK %u\n", (unsigned)ota.received); return; }
+    size_t off = (size_t)rest.substring(0, s1).toInt();
+    if (off < ota.received) {            // duplicate from a resend window
+      Serial.printf("FWU: ACK %u\n", (unsigned)ota.received);
+      return;
+    }
+    uint32_t crc = strtoul(rest.substring(s1 + 1, s2).c_str(), nullptr, 16);
+    uint8_t buf[FWU_CHUNK_MAX];
+    size_t n = 0;
+    const char* b64 = rest.c_str() + s2 + 1;
+    bool good = off == ota.received &&
+                mbedtls_base64_decode(buf, sizeof(buf), &n, (const unsigned char*)b64, strlen(b64)) == 0 &&
+                n && crc32Update(0, buf, n) == crc && ota.received + n <= fwuTotal;
+    if (!good) { Serial.printf("FWU: NAK %u\n", (unsigned)ota.received); return; }
+    if (!ota.feed(buf, n)) { fwuCancel("write failed"); return; }
+    Serial.printf("FWU: ACK %u\n", (unsigned)ota.received);
+    fwuProgress();
+    return;
+  }
+
+  if (sub == "end") {
+    if (!fwuActive()) { Serial.println("ERR: FWU no update in progress"); return; }
+    if (ota.received != fwuTotal) {
+      Serial.printf("ERR: FWU short %u/%u\n", (unsigned)ota.received, (unsigned)fwuTotal);
+      return;
+    }
+    String got;
+    fwuTotal = 0;
+    fwuPct = -1;
+    if (!ota.finish(fwuSha, got)) {
+      Serial.println("ERR: FWU verify failed, running image kept");
+      refreshAll();
+      return;
+    }
+    Serial.printf("FWU: DONE %u %s\n", (unsigned)ota.written, got.c_str());
+    Serial.flush();
+    delay(200);
+    ESP.restart();
+    return;
+  }
+
+  if (sub == "abort") {
+    ota.abort();
+    if (fwuTotal) refreshAll();
+    fwuTotal = 0;
+    fwuPct = -1;
+    Serial.println("OK: FWU aborted");
+    return;
+  }
+
+  if (sub == "status") {
+    if (fwuActive()) Serial.printf("FWU: ACTIVE %u/%u\n", (unsigned)ota.received, (unsigned)fwuTotal);
+    else             Serial.println("FWU: IDLE");
+    return;
+  }
+
+  Serial.println("ERR: FWU BEGIN|DATA|END|ABORT|STATUS");
 }
 
 // ==================  NVS save / load helpers  ==================
@@ -1684,23 +2856,89 @@ void loadTrackNames(){
   prefs.end();
 }
 
-// ===================  Broadcast current IP  ===================
+// ===================  OSC peer / subnet broadcast  ===================
+// Directed broadcast for our subnet, from the DHCP mask (not gw.x.x.255,
+// which is wrong on anything but a /24)
+IPAddress subnetBroadcast() {
+  IPAddress ip = WiFi.localIP(), nm = WiFi.subnetMask(), b;
+  for (int i = 0; i < 4; i++) b[i] = ip[i] | (uint8_t)~nm[i];
+  return b;
+}
+
+bool oscPeerValid() {
+  return oscPeerUntil && (long)(millis() - oscPeerUntil) < 0;
+}
+
+// Where /hello and /ipupdate go: the leased peer, else everyone on the subnet
+IPAddress oscTarget() {
+  return oscPeerValid() ? oscPeer : subnetBroadcast();
+}
+
+// Called for every valid OSC packet: take or renew the lease
+void learnOscPeer(IPAddress from) {
+  if (from == INADDR_NONE || from == WiFi.localIP()) return;
+  if (!oscPeerValid() || from != oscPeer) {
+    oscPeer = from;
+    Serial.printf("OSC: peer %s, unicast from now on\n", from.toString().c_str());
+  }
+  oscPeerUntil = millis() + peerLeaseMs;
+  if (!oscPeerUntil) oscPeerUntil = 1;   // 0 means "no peer"
+}
+
+// ===================  mDNS service advertising  ===================
+// Every unit answers to tds8.local (the IDF responder renames a clashing
+// hostname), but service instances are named after the MAC tail so browsers
+// on a multi-device rack list each unit separately. TXT records let the
+// bridge map an instance to its track range without opening a socket.
+void mdnsStart() {
+  if (!MDNS.begin(mdnsName)) {
+    Serial.println("âš ï¸ mDNS responder failed to start");
+    return;
+  }
+  mdnsUp = true;
+
+  String mac = WiFi.macAddress();
+  mac.replace(":", "");
+  String instance = "TDS-8 " + mac.substring(mac.length() - 6);
+  MDNS.setInstanceName(instance);
+
+  MDNS.addService("osc",  "udp", oscPort);
+  MDNS.addService("http", "tcp", 80);
+  mdnsUpdateTxt();
+  Serial.printf("mDNS: %s.local, instance \"%s\"\n", mdnsName, instance.c_str());
+}
+
+// Re-sent when DEVICE_ID changes; adding an existing key replaces it
+void mdnsUpdateTxt() {
+  if (!mdnsUp) return;
+  int first = deviceID * TRACKS_PER_ID + 1;
+  String tracks = String(first) + "-" + String(first + numScreens - 1);
+  const char* protos[][2] = { { "osc", "udp" }, { "http", "tcp" } };
+  for (auto &p : protos) {
+    MDNS.addServiceTxt(p[0], p[1], "id",      String(deviceID));
+    MDNS.addServiceTxt(p[0], p[1], "fw",      String(FW_VERSION));
+    MDNS.addServiceTxt(p[0], p[1], "tracks",  tracks);
+    MDNS.addServiceTxt(p[0], p[1], "screens", String(numScreens));
+  }
+}
+
+// ===================  Announce current IP  ===================
+// Unicast to the OSC peer while its lease runs, subnet broadcast otherwise
 void broadcastIP() {
   if (WiFi.status() != WL_CONNECTED) return;
 
-  IPAddress gw = WiFi.gatewayIP();
-  IPAddress bcast(gw[0], gw[1], gw[2], 255);
+  IPAddress dest = oscTarget();
   String s = WiFi.localIP().toString();
 
   // Send plain text IP (legacy)
-  Udp.beginPacket(bcast, ipBroadcastPort); Udp.print(s); Udp.endPacket();
+  Udp.beginPacket(dest, ipBroadcastPort); Udp.print(s); Udp.endPacket();
 
-  // Send OSC /ipupdate to LAN broadcast (bridge listens on 0.0.0.0:9000)
+  // Send OSC /ipupdate (bridge listens on 0.0.0.0:9000)
   // Args: ip (string), deviceID (int)
   OSCMessage m("/ipupdate");
   m.add(s.c_str());
   m.add((int)deviceID);
-  Udp.beginPacket(bcast, ipBroadcastPort); m.send(Udp); Udp.endPacket();
+  Udp.beginPacket(dest, ipBroadcastPort); m.send(Udp); Udp.endPacket();
   delay(0);
   Serial.printf("SENT: /ipupdate %s\n", s.c_str());
 }
@@ -1738,6 +2976,67 @@ void forgetWifi() {
   ESP.restart();
 }
 
+// ======================  Idle / power  ======================
+// Input keeps the unit awake; the panels dim and then go dark when it stops.
+// Their RAM and our shadow frames keep the picture, so waking is a contrast
+// + display-on command per panel queued ahead of whatever the waking
+// command draws, not a redraw. While idle the CPU runs at CPU_MHZ_IDLE and
+// loop() blocks for IDLE_POLL_MS per pass instead of spinning, which lets
+// FreeRTOS idle the core. Light sleep is not used: it suspends the
+// USB-Serial/JTAG link that wired units depend on.
+enum IdleLevel : uint8_t { IDLE_AWAKE, IDLE_DIMMED, IDLE_DARK };
+static IdleLevel idleLevel = IDLE_AWAKE;
+static unsigned long lastInputMs = 0;
+static uint16_t idleDimS = IDLE_DIM_S;           // 0 = never
+static uint16_t idleOffS = IDLE_OFF_S;           // 0 = never
+static bool abletonStopped = false;              // /ableton_off seen since the last /ableton_on
+
+static const char* idleName(IdleLevel lv) {
+  return lv == IDLE_AWAKE ? "awake" : lv == IDLE_DIMMED ? "dim" : "dark";
+}
+
+static void setIdleLevel(IdleLevel lv) {
+  if (lv == idleLevel) return;
+  if (idleLevel == IDLE_AWAKE) setCpuFrequencyMhz(CPU_MHZ_IDLE);
+  if (lv == IDLE_AWAKE)        setCpuFrequencyMhz(CPU_MHZ_ACTIVE);
+  idleLevel = lv;
+  oledSetLevel(lv == IDLE_AWAKE ? CONTRAST_FULL : lv == IDLE_DIMMED ? CONTRAST_DIM : 0);
+  Serial.printf("IDLE: %s\n", idleName(lv));
+}
+
+// Every serial line and OSC packet, before it is handled
+void noteInput() {
+  lastInputMs = millis();
+  if (idleLevel != IDLE_AWAKE) setIdleLevel(IDLE_AWAKE);
+}
+
+// Once per loop() pass
+void idleService() {
+  if (currentState != STATE_RUNNING) return;
+  unsigned long quiet = millis() - lastInputMs;
+  unsigned long dimMs = idleDimS * 1000UL;
+  if (abletonStopped && (!dimMs || dimMs > IDLE_ABLETON_OFF_DIM_S * 1000UL)) dimMs = IDLE_ABLETON_OFF_DIM_S * 1000UL;
+  IdleLevel want = IDLE_AWAKE;
+  if (idleOffS && quiet >= idleOffS * 1000UL) want = IDLE_DARK;
+  else if (dimMs && quiet >= dimMs)          want = IDLE_DIMMED;
+  if (want > idleLevel) setIdleLevel(want);
+  if (idleLevel != IDLE_AWAKE) delay(IDLE_POLL_MS);
+}
+
+void saveIdleTimes() {
+  prefs.begin("idle", false);
+  prefs.putUShort("dim", idleDimS);
+  prefs.putUShort("off", idleOffS);
+  prefs.end();
+}
+
+void loadIdleTimes() {
+  prefs.begin("idle", true);
+  idleDimS = prefs.getUShort("dim", IDLE_DIM_S);
+  idleOffS = prefs.getUShort("off", IDLE_OFF_S);
+  prefs.end();
+}
+
 // ==================  WIRED MODE HELPERS (NEW)  ==================
 void saveWiredMode() {
   prefs.begin("mode", false);
@@ -1760,13 +3059,24 @@ void saveDeviceID() {
 void loadDeviceID() {
   prefs.begin("device", true);
   deviceID = prefs.getUChar("id", 0);  // default 0 = first device
-  if (deviceID > 3) deviceID = 0;  // Validate range 0-3
+  if (deviceID > MAX_DEVICE_ID) deviceID = 0;  // Validate range
   prefs.end();
 }
 
 void showStartupSplash() {
   // Draws the initial TDS-8 Logo and PlayOptix logo without any delay.
   const char* letters[] = {"T", "D", "S", "-", "8"};
+
+#if defined(HAVE_BOOT_ANIM)
+  // Animated reveal of the same logos, played frame by frame from loop()
+  for (uint8_t i = 0; i < numScreens; i++) {
+    tcaSelect(i);
+    display.invertDisplay(false);
+    display.clearDisplay();
+    display.display();
+  }
+  if (animStart(BOOT_ANIM, BOOT_ANIM_FRAMES, BOOT_ANIM_SCREENS, BOOT_ANIM_PERIOD_MS)) return;
+#endif
   
   // Clear ALL displays completely first
   for (uint8_t i = 0; i < numScreens; i++) {
@@ -1785,31 +3095,31 @@ void showStartupSplash() {
     switch (i) {
       case 0:
 #if defined(HAVE_T_BITMAP)
-        display.drawBitmap(0, 0, T_BITMAP_DATA, T_BITMAP_W, T_BITMAP_H, SSD1306_WHITE);
+        blitPackBits(T_BITMAP_RLE);
         drewBitmap = true;
 #endif
         break;
       case 1:
 #if defined(HAVE_D_BITMAP)
-        display.drawBitmap(0, 0, D_BITMAP_DATA, D_BITMAP_W, D_BITMAP_H, SSD1306_WHITE);
+        blitPackBits(D_BITMAP_RLE);
         drewBitmap = true;
 #endif
         break;
       case 2:
 #if defined(HAVE_S_BITMAP)
-        display.drawBitmap(0, 0, S_BITMAP_DATA, S_BITMAP_W, S_BITMAP_H, SSD1306_WHITE);
+        blitPackBits(S_BITMAP_RLE);
         drewBitmap = true;
 #endif
         break;
       case 3:
 #if defined(HAVE_DASH_BITMAP)
-        display.drawBitmap(0, 0, DASH_BITMAP_DATA, DASH_BITMAP_W, DASH_BITMAP_H, SSD1306_WHITE);
+        blitPackBits(DASH_BITMAP_RLE);
         drewBitmap = true;
 #endif
         break;
       case 4:
 #if defined(HAVE_EIGHT_BITMAP)
-        display.drawBitmap(0, 0, EIGHT_BITMAP_DATA, EIGHT_BITMAP_W, EIGHT_BITMAP_H, SSD1306_WHITE);
+        blitPackBits(EIGHT_BITMAP_RLE);
         drewBitmap = true;
 #endif
         break;
@@ -1826,16 +3136,15 @@ void showStartupSplash() {
     display.display();
   }
   
-  // Display 7: PlayOptix logo
-  tcaSelect(7);
+  // Last display: PlayOptix logo
+  tcaSelect(numScreens - 1);
   display.invertDisplay(false);
   display.clearDisplay();
   display.display();
   delay(10);
   display.setTextWrap(false);
   display.setTextColor(SSD1306_WHITE);
-  display.drawBitmap(0, 0, playoptix_logo, LOGO_WIDTH, LOGO_HEIGHT, SSD1306_WHITE);
-  display.fillRect(0, 54, 128, 10, SSD1306_BLACK);
+  blitPackBits(PLAYOPTIX_BITMAP_RLE);
   display.display();
 
   // Display 0: Digital scribble strip (if provided)
@@ -1845,7 +3154,7 @@ void showStartupSplash() {
   display.clearDisplay();
   display.display();
   delay(5);
-  display.drawBitmap(0, 0, SCRIBBLE_BITMAP_DATA, SCRIBBLE_BITMAP_W, SCRIBBLE_BITMAP_H, SSD1306_WHITE);
+  blitPackBits(SCRIBBLE_BITMAP_RLE);
   display.display();
 #endif
 }
@@ -1938,16 +3247,174 @@ void showQuickStartInstructions() {
   display.clearDisplay();
   display.display();
 
-  // Display 7 (OLED 8) - Show PlayOptix logo
-  tcaSelect(7);
+  // Last display - Show PlayOptix logo
+  tcaSelect(numScreens - 1);
   display.clearDisplay();
   display.display(); // Ensure clear is applied
   delay(10);
-  display.drawBitmap(0, 0, playoptix_logo, LOGO_WIDTH, LOGO_HEIGHT, SSD1306_WHITE);
-  display.fillRect(0, 54, 128, 10, SSD1306_BLACK); // Cover artifacts at bottom
+  blitPackBits(PLAYOPTIX_BITMAP_RLE);
   display.display();
 }
 
+// =======================  Benchmark  =======================
+// BENCH <load|scroll|rename|utf8|mixed|anim|all> [gapMs] replays a command trace
+// and times each command from receipt until the last byte of its frames is
+// on the bus. gapMs = 0 waits for the bus after every command; otherwise
+// commands are issued every gapMs and everything queued behind a busy bus
+// completes when it next goes idle. Urgent-lane commands (/activetrack)
+// complete as soon as their own frames are out. Blocks loop() while
+// running; names, track numbers and the active track are put back after.
+//   load    32-track project load (four banks on a one-mux unit)
+//   scroll  active track swept up and down the rack
+//   rename  renames of mixed lengths hopping between slots
+//   utf8    the rename trace with non-ASCII names (glyph store + cache)
+//   mixed   names with a highlight move every eighth command, always
+//           paced (BENCH_MIXED_GAP_MS when gapMs is 0); hl_* is highlight
+//           latency, which should match an idle scroll
+//   anim    diagnostic patterns, every screen, every frame
+// One line per trace, for the bridge or a CI log to keep:
+//   BENCH: trace=load ops=32 gap_ms=0 p50_us=.. p99_us=.. max_us=.. fps=.. bytes_per_op=.. ...
+#define BENCH_MAX_OPS       128
+#define BENCH_MIXED_GAP_MS  2
+
+static const char* const BENCH_NAMES[] = {
+  "Kick", "Snare Top", "Hats", "Bass DI",
+  "Lead Vox", "Pad Wide Stereo", "Room Mics L/R", "FX Return Long Tail"
+};
+
+static const char* const BENCH_UTF8_NAMES[] = {
+  "Kick Dr\xC3\xBCm", "Caf\xC3\xA9 Snare", "H\xC3\xA4ts \xE2\x80\x93 Open", "Ba\xC3\x9F DI",
+  "L\xC3\xA9" "ad Vox \xE2\x99\xAA", "Pad \xC3\x98 Wide", "Ra\xC4\x8Dun Mics", "FX \xC5\x81ong Ta\xC3\xAFl"
+};
+
+static int64_t  benchIssued[BENCH_MAX_OPS];
+static uint32_t benchLat[BENCH_MAX_OPS];
+static uint32_t benchHl[BENCH_MAX_OPS];   // latencies of urgent-lane commands only
+static bool     benchUrgent[BENCH_MAX_OPS];
+static bool     benchDone[BENCH_MAX_OPS];
+
+// Command i of a trace; false once the trace is done
+static bool benchCommand(const String& trace, int i, String& out) {
+  int n = numScreens;
+  if (trace == "load") {
+    if (i >= 32) return false;
+    out = "/trackname " + String(i % n) + " \"" + BENCH_NAMES[i % 8] + " " + String(i + 1) + "\" " + String(i);
+  } else if (trace == "scroll") {
+    if (i >= 64) return false;
+    int span = max(1, 2 * n - 2);
+    int pos = i % span;
+    out = "/activetrack " + String(pos < n ? pos : span - pos);
+  } else if (trace == "rename") {
+    if (i >= 96) return false;
+    out = "/trackname " + String((i * 3) % n) + " \"" + BENCH_NAMES[(i * 5) % 8] + " v" + String(i) + "\"";
+  } else if (trace == "utf8") {
+    if (i >= 96) return false;
+    out = "/trackname " + String((i * 3) % n) + " \"" + BENCH_UTF8_NAMES[(i * 5) % 8] + " v" + String(i) + "\"";
+  } else if (trace == "mixed") {
+    if (i >= 64) return false;
+    if (i % 8 == 7) out = "/activetrack " + String((i / 8) % n);
+    else            out = "/trackname " + String(i % n) + " \"" + BENCH_NAMES[(i * 3) % 8] + " " + String(i + 1) + "\"";
+  } else if (trace == "anim") {
+    if (i >= 30) return false;
+    out = "";   // drawn directly, see runBench()
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static int benchCmp(const void* a, const void* b) {
+  uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+  return x < y ? -1 : x > y;
+}
+
+static void runBench(const String& trace, uint32_t gapMs) {
+  String cmd;
+  if (!benchCommand(trace, 0, cmd)) {
+    Serial.printf("ERR: Unknown bench trace '%s'\n", trace.c_str());
+    return;
+  }
+
+  String savedNames[MAX_SCREENS];
+  int savedNums[MAX_SCREENS];
+  for (int i = 0; i < numScreens; i++) { savedNames[i] = trackNames[i]; savedNums[i] = actualTrackNumbers[i]; }
+  int savedActive = activeTrack;
+  bool savedBanner = abletonBannerShown, savedWant = wantAbletonBanner;
+
+  animFinish();
+  while (serviceNameRenders()) {}
+  while (!oledBusIdle()) delay(1);
+
+  const bool anim = trace == "anim";
+  if (trace == "mixed" && !gapMs) gapMs = BENCH_MIXED_GAP_MS;
+  const int64_t gapUs = (int64_t)gapMs * 1000;
+  uint32_t frames0 = busFrames, bytes0 = busBytes;
+  int64_t t0 = esp_timer_get_time(), nextAt = t0;
+  int issued = 0, done = 0, hl = 0;
+
+  // Frames that changed nothing never reach the bus: those count as 0
+  auto complete = [&](int k, int64_t end) {
+    benchLat[k] = end > benchIssued[k] ? (uint32_t)(end - benchIssued[k]) : 0;
+    if (benchUrgent[k]) benchHl[hl++] = benchLat[k];
+    benchDone[k] = true;
+    done++;
+  };
+
+  for (;;) {
+    bool more = issued < BENCH_MAX_OPS && benchCommand(trace, issued, cmd);
+    bool idle = !nameDirty && oledBusIdle();
+    if (done < issued) {
+      int64_t oldest = oledUrgentPendingSince();
+      // Command k's frames were asked for before command k+1 arrived
+      for (int k = 0; k < issued; k++) {
+        int64_t bound = k + 1 < issued ? benchIssued[k + 1] : INT64_MAX;
+        if (benchUrgent[k] && !benchDone[k] && oldest >= bound) complete(k, urgentDoneUs);
+      }
+    }
+    if (idle && done < issued) {
+      for (int k = 0; k < issued; k++) if (!benchDone[k]) complete(k, busDoneUs);
+    }
+    if (!more && done == issued) break;
+
+    int64_t now = esp_timer_get_time();
+    if (more && (gapMs ? now >= nextAt : idle)) {
+      benchIssued[issued] = now;
+      benchUrgent[issued] = cmd.startsWith("/activetrack");
+      benchDone[issued] = false;
+      if (anim) diagDrawFrame(issued);
+      else      handleSerialLine(cmd);
+      issued++;
+      nextAt += gapUs;
+      continue;
+    }
+    if (serviceNameRenders()) continue;   // loop() isn't running: draw deferred names here
+    delay(1);
+  }
+  int64_t elapsed = max<int64_t>(1, esp_timer_get_time() - t0);
+  uint32_t frames = busFrames - frames0, bytes = busBytes - bytes0;
+
+  for (int i = 0; i < numScreens; i++) { trackNames[i] = savedNames[i]; actualTrackNumbers[i] = savedNums[i]; }
+  activeTrack = savedActive;
+  abletonBannerShown = savedBanner;
+  wantAbletonBanner = savedWant;
+  if (currentState == STATE_RUNNING) refreshAll();
+  while (!oledBusIdle()) delay(1);
+
+  qsort(benchLat, issued, sizeof(benchLat[0]), benchCmp);
+  Serial.printf("BENCH: trace=%s ops=%d gap_ms=%u p50_us=%u p99_us=%u max_us=%u fps=%.1f "
+                "bytes_per_op=%u frames=%u elapsed_ms=%u screens=%d path=%s",
+                trace.c_str(), issued, (unsigned)gapMs,
+                (unsigned)benchLat[(issued - 1) * 50 / 100], (unsigned)benchLat[(issued - 1) * 99 / 100],
+                (unsigned)benchLat[issued - 1], frames * 1e6 / elapsed, (unsigned)(bytes / issued),
+                (unsigned)frames, (unsigned)(elapsed / 1000), numScreens, oledBusReady ? "async" : "wire");
+  if (hl) {
+    qsort(benchHl, hl, sizeof(benchHl[0]), benchCmp);
+    Serial.printf(" hl_ops=%d hl_p50_us=%u hl_p99_us=%u", hl,
+                  (unsigned)benchHl[(hl - 1) * 50 / 100], (unsigned)benchHl[(hl - 1) * 99 / 100]);
+  }
+  Serial.println();
+}
+
 // ==================  SERIAL COMMAND HANDLER (NEW)  ==================
 void handleSerialLine(const String& line) {
   String cmd = line;
@@ -1961,17 +3428,18 @@ void handleSerialLine(const String& line) {
 
   // VERSION
   if (head == "version") {
-    int trackStart = deviceID * 8 + 1;
-    int trackEnd = (deviceID + 1) * 8;
+    int trackStart = deviceID * TRACKS_PER_ID + 1;
+    int trackEnd = trackStart + numScreens - 1;
     Serial.printf("VERSION: %s\n", FW_VERSION);
     Serial.printf("BUILD: %s\n", FW_BUILD);
     Serial.printf("DEVICE_ID: %d\n", deviceID);
     Serial.printf("TRACKS: %d-%d\n", trackStart, trackEnd);
+    Serial.printf("SCREENS: %d\n", numScreens);
     Serial.printf("MODE: %s\n", wiredOnly ? "WIRED" : "WIFI");
     return;
   }
 
-  // DEVICE_ID 0-3
+  // DEVICE_ID 0-15
   if (head == "device_id") {
     String arg = (sp >= 0) ? cmd.substring(sp + 1) : "";
     arg.trim();
@@ -1979,12 +3447,14 @@ void handleSerialLine(const String& line) {
     
     Serial.printf("DEBUG: Received DEVICE_ID command with newID=%d, current deviceID=%d\n", newID, deviceID);
     
-    if (newID < 0 || newID > 3) {
-      Serial.println("ERR: DEVICE_ID must be 0-3");
-      Serial.println("   Device 0 = tracks 1-8");
-      Serial.println("   Device 1 = tracks 9-16");
-      Serial.println("   Device 2 = tracks 17-24");
-      Serial.println("   Device 3 = tracks 25-32");
+    if (newID < 0 || newID > MAX_DEVICE_ID) {
+      Serial.printf("ERR: DEVICE_ID must be 0-%d\n", MAX_DEVICE_ID);
+      Serial.printf("   Device 0 = tracks 1-%d\n", numScreens);
+      Serial.printf("   Device 1 = tracks %d-%d\n", TRACKS_PER_ID + 1, TRACKS_PER_ID + numScreens);
+      Serial.println("   ...");
+      Serial.printf("   Device %d = tracks %d-%d\n", MAX_DEVICE_ID,
+                    MAX_DEVICE_ID * TRACKS_PER_ID + 1, MAX_DEVICE_ID * TRACKS_PER_ID + numScreens);
+      if (muxCount > 1) Serial.printf("   (this unit spans %d IDs)\n", muxCount);
       return;
     }
     
@@ -2002,7 +3472,7 @@ void handleSerialLine(const String& line) {
     saveDeviceID();
     
     // Update actual track numbers based on device ID
-    int offset = deviceID * 8;
+    int offset = deviceID * TRACKS_PER_ID;
     for (int i = 0; i < numScreens; i++) {
       actualTrackNumbers[i] = offset + i;
     }
@@ -2013,7 +3483,9 @@ void handleSerialLine(const String& line) {
       refreshAll();
     }
     
-    Serial.printf("OK: DEVICE_ID set to %d (tracks %d-%d)\n", deviceID, offset + 1, offset + 8);
+    mdnsUpdateTxt();
+
+    Serial.printf("OK: DEVICE_ID set to %d (tracks %d-%d)\n", deviceID, offset + 1, offset + numScreens);
     return;
   }
 
@@ -2077,6 +3549,60 @@ void handleSerialLine(const String& line) {
     return;
   }
 
+  // BENCH <trace|all> [gapMs]
+  if (head == "bench") {
+    String arg = (sp >= 0) ? cmd.substring(sp + 1) : "all";
+    arg.trim(); arg.toLowerCase();
+    int sp2 = arg.indexOf(' ');
+    uint32_t gapMs = sp2 > 0 ? (uint32_t)max(0L, arg.substring(sp2 + 1).toInt()) : 0;
+    String trace = sp2 > 0 ? arg.substring(0, sp2) : arg;
+    if (trace == "all") {
+      for (const char* t : { "load", "scroll", "rename", "utf8", "mixed", "anim" }) runBench(t, gapMs);
+    } else {
+      runBench(trace, gapMs);
+    }
+    return;
+  }
+
+  // GLYPHS - glyph store and rasterised-glyph cache counters
+  if (head == "glyphs") {
+#if HAVE_UTF8_GLYPHS
+    int used = 0;
+    for (const GlyphSlot& g : glyphCache) if (g.used) used++;
+    Serial.printf("OK: GLYPHS store=%d cache=%d/%d hits=%lu misses=%lu\n", UTF8_GLYPH_COUNT,
+                  used, GLYPH_CACHE_SLOTS, (unsigned long)glyphHits, (unsigned long)glyphMisses);
+#else
+    Serial.println("OK: GLYPHS store=0 (ASCII only)");
+#endif
+    return;
+  }
+
+  // IDLE [dimSec offSec] - show or set the idle timers (0 = never)
+  if (head == "idle") {
+    String arg = (sp >= 0) ? cmd.substring(sp + 1) : "";
+    arg.trim();
+    if (arg.length()) {
+      int sp2 = arg.indexOf(' ');
+      long d = arg.substring(0, sp2 > 0 ? sp2 : arg.length()).toInt();
+      long o = sp2 > 0 ? arg.substring(sp2 + 1).toInt() : idleOffS;
+      if (d < 0 || o < 0 || d > 65535 || o > 65535) {
+        Serial.println("ERR: Format: IDLE <dimSec> <offSec> (0 = never)");
+        return;
+      }
+      idleDimS = d;
+      idleOffS = o;
+      saveIdleTimes();
+    }
+    Serial.printf("OK: IDLE %s dim=%us off=%us\n", idleName(idleLevel), idleDimS, idleOffS);
+    return;
+  }
+
+  // FWU <BEGIN|DATA|END|ABORT|STATUS> ...
+  if (head == "fwu") {
+    handleFwu(sp >= 0 ? cmd.substring(sp + 1) : "");
+    return;
+  }
+
   // REBOOT
   if (head == "reboot") {
     Serial.println("OK: Rebooting...");
@@ -2121,11 +3647,11 @@ void handleSerialLine(const String& line) {
 
               trackNames[idx] = finalName;
               actualTrackNumbers[idx] = actualTrack;
-              drawTrackName(idx, trackNames[idx]);
+              queueNameRender(idx);
               Serial.printf("OK: /trackname %d \"%s\" (track %d)\n", idx, finalName.c_str(), actualTrack);
               return;
             } else {
-              Serial.println("ERR: Index out of range (0-7)");
+              Serial.printf("ERR: Index out of range (0-%d)\n", numScreens - 1);
               return;
             }
           }
@@ -2161,11 +3687,11 @@ void handleSerialLine(const String& line) {
             String finalName = (name == "Track") ? "" : name;
             trackNames[idx] = finalName;
             actualTrackNumbers[idx] = actualTrack;
-            drawTrackName(idx, trackNames[idx]);
+            queueNameRender(idx);
             Serial.printf("OK: /trackname %d \"%s\" (track %d) [tolerant]\n", idx, finalName.c_str(), actualTrack);
             return;
           } else {
-            Serial.println("ERR: Index out of range (0-7)");
+            Serial.printf("ERR: Index out of range (0-%d)\n", numScreens - 1);
             return;
           }
         }
@@ -2184,33 +3710,34 @@ void handleSerialLine(const String& line) {
       if (idx == -1) {
         int old = activeTrack;
         activeTrack = -1;
-        if (old >= 0) drawTrackName(old, trackNames[old]);
+        if (old >= 0) drawTrackNameUrgent(old);
         Serial.println("OK: /activetrack -1 (clear)");
       } else if (idx >= 0 && idx < numScreens) {
         int old = activeTrack;
         activeTrack = idx;
-        if (old >= 0) drawTrackName(old, trackNames[old]);
-        drawTrackName(activeTrack, trackNames[activeTrack]);
+        if (old >= 0) drawTrackNameUrgent(old);
+        drawTrackNameUrgent(activeTrack);
         Serial.printf("OK: /activetrack %d\n", idx);
       } else {
-        Serial.println("ERR: Index out of range (0-7 or -1 to clear)");
+        Serial.printf("ERR: Index out of range (0-%d or -1 to clear)\n", numScreens - 1);
       }
       return;
     }
-    Serial.println("ERR: Format: /activetrack <idx> (0-7, or -1 to clear)");
+    Serial.printf("ERR: Format: /activetrack <idx> (0-%d, or -1 to clear)\n", numScreens - 1);
     return;
   }
 
   // /ableton_on - Ableton is connected
   if (cmd.startsWith("/ableton_on")) {
     abletonConnected = true;
+    abletonStopped = false;
     heartbeatFlashUntil = millis() + 300;  // Flash heartbeat for 300ms
     if (showingDisconnectMessage) {
       showingDisconnectMessage = false;
       refreshAll(); // Redraw track names
     } else {
-      // Just redraw OLED 8 to show heartbeat
-      drawTrackName(7, trackNames[7]);
+      // Just redraw the last OLED to show heartbeat
+      drawTrackNameUrgent(numScreens - 1);
     }
     // Ableton connected
     return;
@@ -2219,6 +3746,7 @@ void handleSerialLine(const String& line) {
   // /ableton_off - Ableton disconnected
   if (cmd.startsWith("/ableton_off")) {
     abletonConnected = false;
+    abletonStopped = true;   // panels dim after IDLE_ABLETON_OFF_DIM_S
     // Don't show disconnect message - it causes false positives
     // Just update the connection flag
     return;
@@ -2251,13 +3779,17 @@ void handleSerialLine(const String& line) {
   Serial.println("ERR: Unknown command");
   Serial.println("ðŸ“‹ Available commands:");
   Serial.println("   VERSION - Show firmware version");
-  Serial.println("   DEVICE_ID 0-3 - Set device ID for multi-device setups");
+  Serial.println("   DEVICE_ID 0-15 - Set device ID for multi-device setups");
   Serial.println("   CLEAR_TRACKS - Clear all stored track names");
   Serial.println("   WIRED_ONLY true/false - Toggle wired/WiFi mode");
   Serial.println("   WIFI_JOIN \"ssid\" \"password\" - Save WiFi credentials");
   Serial.println("   FORGET - Clear WiFi credentials");
   Serial.println("   REBOOT - Restart device");
-  Serial.println("   /trackname <idx> <name> - Set track name (0-7)");
+  Serial.println("   BENCH load|scroll|rename|utf8|mixed|anim|all [gapMs] - Render/I2C benchmark");
+  Serial.println("   GLYPHS - Glyph store size and cache hit/miss counts");
+  Serial.println("   FWU BEGIN|DATA|END|ABORT|STATUS - Firmware update over serial (bridge)");
+  Serial.println("   IDLE [dimSec offSec] - Show/set panel dim and off timers (0 = never)");
+  Serial.printf("   /trackname <idx> <name> - Set track name (0-%d)\n", numScreens - 1);
   Serial.println("   /activetrack <idx> - Highlight active track");
   Serial.println("   /reannounce - Broadcast IP (WiFi mode only)");
 }
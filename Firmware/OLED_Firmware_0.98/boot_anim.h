@@ -0,0 +1,294 @@
+#pragma once
+#include <Arduino.h>
+// 32 frames x 8 screens, mask + PackBits XOR pages per record
+#define BOOT_ANIM_FRAMES 32
+#define BOOT_ANIM_SCREENS 8
+#define BOOT_ANIM_PERIOD_MS 33
+const uint8_t BOOT_ANIM[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xe3, 0x00, 0xbe, 0x20, 0xe2, 0x00, 0x01, 0xd7, 0x00, 0xeb, 0x30, 0xfc, 0x20, 0xc6,
+  0x00, 0x01, 0xcd, 0x00, 0xfe, 0x20, 0xf8, 0x30, 0xfd, 0x20, 0xc5, 0x00, 0x00, 0x01, 0xcd, 0x00,
+  0xfe, 0x20, 0xff, 0x30, 0xf9, 0x10, 0xff, 0x30, 0xfe, 0x20, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xe3, 0x00, 0xd6, 0x40, 0xfe, 0xc0, 0xec, 0x40, 0xe2, 0x00, 0x01, 0xd7, 0x00, 0xff, 0xc0, 0xff,
+  0x00, 0xef, 0x80, 0xff, 0x00, 0xfd, 0x40, 0xff, 0xc0, 0xff, 0x80, 0xcb, 0x00, 0x01, 0xd1, 0x00,
+  0xff, 0x80, 0x00, 0xc0, 0xfe, 0x40, 0xff, 0x00, 0xf8, 0x80, 0x00, 0x00, 0xfd, 0x40, 0x00, 0xc0,
+  0xfe, 0x80, 0xcb, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x05, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0xfd,
+  0x80, 0xfd, 0xc0, 0xfd, 0x80, 0x05, 0x00, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0xca, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xe3, 0x00, 0xd9, 0x02, 0xfe, 0x00, 0xfe, 0x03, 0xec, 0x02, 0xe2, 0x00, 0x02, 0xd7,
+  0x00, 0xff, 0x03, 0x02, 0x00, 0x03, 0x03, 0xed, 0x01, 0xff, 0x03, 0xff, 0x02, 0x05, 0x00, 0x01,
+  0x01, 0x03, 0x03, 0x02, 0xce, 0x00, 0x02, 0xd4, 0x00, 0xff, 0x02, 0x06, 0x03, 0x01, 0x01, 0x00,
+  0x02, 0x02, 0x03, 0xfc, 0x01, 0x00, 0x00, 0xfb, 0x01, 0xff, 0x03, 0xfe, 0x02, 0x05, 0x00, 0x01,
+  0x01, 0x03, 0x03, 0x02, 0xce, 0x00, 0x00, 0x02, 0xd3, 0x00, 0xff, 0x02, 0x05, 0x03, 0x01, 0x00,
+  0x02, 0x02, 0x03, 0xfe, 0x01, 0xff, 0x00, 0xfd, 0x02, 0xff, 0x00, 0xfe, 0x01, 0x07, 0x03, 0x02,
+  0x02, 0x00, 0x01, 0x03, 0x03, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe3, 0x00, 0xd9, 0x0c,
+  0xfe, 0x00, 0xe9, 0x0c, 0xe2, 0x00, 0x02, 0xd7, 0x00, 0xff, 0x0c, 0x04, 0x00, 0x0c, 0x0c, 0x00,
+  0x08, 0xf1, 0x0c, 0xfd, 0x08, 0x09, 0x00, 0x04, 0x04, 0x0c, 0x08, 0x08, 0x00, 0x04, 0x0c, 0x08,
+  0xd0, 0x00, 0x02, 0xd5, 0x00, 0xff, 0x0c, 0x0a, 0x04, 0x00, 0x08, 0x0c, 0x04, 0x00, 0x00, 0x08,
+  0x08, 0x0c, 0x0c, 0xfb, 0x04, 0xff, 0x0c, 0xfe, 0x08, 0x00, 0x00, 0xfe, 0x04, 0x07, 0x0c, 0x08,
+  0x08, 0x00, 0x04, 0x04, 0x0c, 0x08, 0xd1, 0x00, 0x00, 0x02, 0xd4, 0x00, 0xff, 0x0c, 0x09, 0x04,
+  0x08, 0x08, 0x0c, 0x04, 0x00, 0x08, 0x08, 0x0c, 0x0c, 0xf9, 0x04, 0xff, 0x0c, 0xff, 0x08, 0x07,
+  0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x0c, 0xce, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbd, 0x00,
+  0xff, 0x30, 0xfe, 0x00, 0xfe, 0x30, 0xcd, 0x00, 0x02, 0xd7, 0x00, 0xff, 0x30, 0x07, 0x00, 0x30,
+  0x30, 0x00, 0x30, 0x30, 0x00, 0x00, 0xf3, 0x20, 0x0e, 0x00, 0x10, 0x10, 0x30, 0x30, 0x20, 0x00,
+  0x10, 0x30, 0x30, 0x20, 0x00, 0x10, 0x30, 0x20, 0xd2, 0x00, 0x02, 0xd7, 0x00, 0x0c, 0x20, 0x30,
+  0x10, 0x00, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30, 0x10, 0x10, 0x00, 0xf6, 0x20, 0x00, 0x00, 0xfe,
+  0x10, 0x09, 0x30, 0x20, 0x20, 0x00, 0x10, 0x10, 0x30, 0x20, 0x00, 0x10, 0xd1, 0x00, 0x00, 0x02,
+  0xd6, 0x00, 0x0b, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30, 0x10, 0x10, 0xfe,
+  0x20, 0xff, 0x30, 0xff, 0x10, 0xff, 0x30, 0xfe, 0x20, 0xff, 0x10, 0x09, 0x30, 0x20, 0x00, 0x10,
+  0x30, 0x20, 0x00, 0x10, 0x30, 0x20, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe3, 0x00, 0xde, 0xc0,
+  0xfe, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xe9, 0xc0, 0xe2, 0x00, 0x02, 0xd7, 0x00, 0xff, 0xc0, 0x08,
+  0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xf7, 0x00, 0xfd, 0x40, 0x0e, 0xc0, 0x80,
+  0x80, 0x00, 0x40, 0xc0, 0x80, 0x00, 0x40, 0xc0, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0xd3, 0x00, 0x02,
+  0xd7, 0x00, 0x0e, 0xc0, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0x40, 0x00, 0x80, 0xc0, 0x40,
+  0x40, 0x00, 0xfc, 0x80, 0xff, 0x00, 0xfe, 0x40, 0xff, 0xc0, 0xff, 0x80, 0x06, 0x00, 0x40, 0xc0,
+  0xc0, 0x80, 0x00, 0x40, 0xcf, 0x00, 0x00, 0x02, 0xd6, 0x00, 0x0e, 0xc0, 0x40, 0x00, 0xc0, 0xc0,
+  0x00, 0x80, 0xc0, 0x40, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x00, 0xfb, 0x80, 0x0f, 0x00, 0x40, 0x40,
+  0xc0, 0x80, 0x00, 0x40, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0x40, 0xc0, 0x80, 0xd1, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xc3, 0x00, 0xfe, 0x03, 0xfe, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xcd,
+  0x00, 0x04, 0xd7, 0x00, 0xff, 0x03, 0x0c, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x03, 0xfb, 0x01, 0xff, 0x03, 0xff, 0x02, 0xff, 0x00, 0x0d, 0x01, 0x03, 0x02,
+  0x00, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0x02, 0x00, 0x03, 0x03, 0xd4, 0x00, 0x04, 0xd8, 0x00,
+  0xff, 0x03, 0x0d, 0x00, 0x02, 0x03, 0x00, 0x02, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03,
+  0x03, 0xfa, 0x01, 0xff, 0x03, 0xfe, 0x02, 0xff, 0x01, 0xff, 0x03, 0x02, 0x02, 0x00, 0x01, 0xcd,
+  0x00, 0x00, 0x04, 0xd7, 0x00, 0xff, 0x03, 0x23, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03, 0x01, 0x00,
+  0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x02, 0x00,
+  0x03, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x03, 0x03, 0x00, 0x01, 0x03, 0xd1, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xe3, 0x00, 0xe3, 0x08, 0xff, 0x00, 0xfe, 0x0c, 0xfe, 0x00, 0xff, 0x0c, 0xfe, 0x00,
+  0xfe, 0x0c, 0xec, 0x08, 0xe2, 0x00, 0x04, 0xd7, 0x00, 0xff, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00,
+  0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xf8, 0x00, 0x11, 0x04, 0x0c, 0x0c, 0x08,
+  0x00, 0x04, 0x0c, 0x08, 0x00, 0x0c, 0x0c, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x0c, 0x0c, 0xd5, 0x00,
+  0x04, 0xd8, 0x00, 0xff, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00,
+  0x08, 0x0c, 0x04, 0xf6, 0x00, 0xff, 0x04, 0x04, 0x0c, 0x08, 0x08, 0x00, 0x04, 0xcb, 0x00, 0x00,
+  0x04, 0xd7, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00,
+  0x08, 0x0c, 0x04, 0xf9, 0x00, 0x0e, 0x04, 0x0c, 0x08, 0x00, 0x0c, 0x0c, 0x00, 0x04, 0x0c, 0x00,
+  0x04, 0x0c, 0x00, 0x00, 0x0c, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x00, 0xe6, 0x10, 0xfe,
+  0x30, 0xff, 0x00, 0xfe, 0x30, 0xfe, 0x00, 0xff, 0x30, 0xfe, 0x00, 0xe9, 0x30, 0xe2, 0x00, 0x04,
+  0xd7, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x30, 0x30, 0xf6, 0x00, 0x10, 0x10, 0x30, 0x30, 0x00, 0x10, 0x30, 0x20, 0x00, 0x30, 0x30, 0x00,
+  0x30, 0x30, 0x00, 0x00, 0x30, 0x20, 0xd6, 0x00, 0x04, 0xd8, 0x00, 0xff, 0x30, 0x0b, 0x00, 0x30,
+  0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x10, 0x30, 0xf1, 0x00, 0x00, 0x10, 0xc9, 0x00,
+  0x00, 0x04, 0xd7, 0x00, 0x0d, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30,
+  0x00, 0x30, 0x30, 0xf7, 0x00, 0xff, 0x30, 0x0b, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x30, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe2, 0x00, 0xea, 0x80, 0xfe, 0x00,
+  0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xfe, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xec, 0x80,
+  0xe2, 0x00, 0x04, 0xd7, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf4, 0x00, 0x0e, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0,
+  0x00, 0x00, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0xd6, 0x00, 0x04, 0xd8, 0x00, 0xff, 0xc0, 0x0e, 0x00,
+  0x40, 0xc0, 0x00, 0x40, 0xc0, 0x80, 0x00, 0xc0, 0x80, 0x00, 0x40, 0xc0, 0x80, 0x80, 0xbb, 0x00,
+  0x00, 0x04, 0xd7, 0x00, 0x0e, 0xc0, 0x80, 0x00, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0x40, 0xc0,
+  0x00, 0x00, 0xc0, 0x80, 0xf9, 0x00, 0xff, 0xc0, 0x0c, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0,
+  0x00, 0x80, 0xc0, 0x00, 0x00, 0xc0, 0xd1, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x80, 0xf9, 0xc0,
+  0xff, 0x80, 0xff, 0x00, 0xff, 0xc0, 0xe6, 0x00, 0xff, 0x80, 0xfd, 0xc0, 0xff, 0x80, 0xf1, 0x00,
+  0x01, 0xc0, 0x80, 0xfd, 0x00, 0x02, 0x80, 0xc0, 0x80, 0xe1, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x02,
+  0xd1, 0x00, 0xfe, 0x02, 0xd7, 0x00, 0xfe, 0x02, 0xe9, 0x00, 0x08, 0xe3, 0x00, 0xe9, 0x03, 0xfe,
+  0x00, 0xfe, 0x03, 0xff, 0x00, 0xfe, 0x03, 0xfe, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xe9, 0x03, 0xe2,
+  0x00, 0x08, 0xd7, 0x00, 0xff, 0x03, 0x0c, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x03, 0xf4, 0x00, 0xff, 0x03, 0x0c, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0xd6, 0x00, 0x08, 0xd7, 0x00, 0x11, 0x03, 0x02, 0x00, 0x03,
+  0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x03, 0xfd, 0x02,
+  0xc1, 0x00, 0x00, 0x08, 0xd7, 0x00, 0xff, 0x03, 0x0d, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02,
+  0x00, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0xfc, 0x02, 0xfe, 0x03, 0x0d, 0x00, 0x02, 0x03, 0x01,
+  0x00, 0x02, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0xd1, 0x00, 0x00, 0x08, 0xec, 0x00,
+  0xff, 0x03, 0x00, 0x01, 0xfc, 0x00, 0xff, 0x01, 0x04, 0x03, 0x02, 0x00, 0x03, 0x03, 0xe8, 0x00,
+  0x03, 0x02, 0x03, 0x03, 0x01, 0xfd, 0x00, 0x03, 0x01, 0x03, 0x03, 0x02, 0xf3, 0x00, 0xff, 0x03,
+  0xda, 0x00, 0x08, 0xfb, 0x00, 0x08, 0x08, 0x0c, 0x04, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0xf7,
+  0x00, 0x00, 0x08, 0xf3, 0x00, 0xfe, 0x08, 0xf8, 0x00, 0xff, 0x08, 0x05, 0x0c, 0x04, 0x04, 0x00,
+  0x00, 0x04, 0xfb, 0x00, 0x03, 0x08, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0xff,
+  0x08, 0xf3, 0x00, 0xff, 0x08, 0xff, 0x04, 0xff, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x08, 0xf5,
+  0x00, 0x08, 0xcd, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xff, 0x00, 0xfe, 0x0c, 0xfe, 0x00,
+  0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xcd, 0x00, 0x08, 0xd7, 0x00, 0xff, 0x0c, 0x0c, 0x00, 0x0c,
+  0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xf4, 0x00, 0xff, 0x0c, 0x0c,
+  0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0xd6, 0x00, 0x08,
+  0xd7, 0x00, 0x17, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0x08, 0x04,
+  0x04, 0x0c, 0x0c, 0x08, 0x08, 0x00, 0x00, 0x04, 0x04, 0x0c, 0x0c, 0xfe, 0x08, 0xc6, 0x00, 0x00,
+  0x08, 0xd6, 0x00, 0xff, 0x0c, 0x0a, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04,
+  0x0c, 0xfe, 0x08, 0xf9, 0x04, 0xff, 0x0c, 0x09, 0x08, 0x0c, 0x0c, 0x00, 0x08, 0x0c, 0x04, 0x00,
+  0x08, 0x0c, 0xd0, 0x00, 0x00, 0x08, 0xec, 0x00, 0xfe, 0x0c, 0xfa, 0x00, 0xff, 0x0c, 0x02, 0x00,
+  0x0c, 0x0c, 0xfe, 0x00, 0x00, 0x08, 0xfc, 0x0c, 0x00, 0x08, 0xfe, 0x00, 0xff, 0x0c, 0xfb, 0x00,
+  0xff, 0x0c, 0x03, 0x00, 0x0c, 0x0c, 0x04, 0xf9, 0x00, 0x06, 0x04, 0x0c, 0x0c, 0x00, 0x00, 0x08,
+  0x08, 0xfc, 0x0c, 0x00, 0x08, 0xfe, 0x00, 0xfc, 0x0c, 0x07, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x0c,
+  0x0c, 0x08, 0xfd, 0x00, 0xff, 0x0c, 0xeb, 0x00, 0x08, 0xfc, 0x00, 0xff, 0x10, 0x00, 0x30, 0xfe,
+  0x00, 0x03, 0x30, 0x20, 0x00, 0x20, 0xfe, 0x00, 0x03, 0x20, 0x30, 0x20, 0x20, 0xfe, 0x00, 0x05,
+  0x20, 0x00, 0x20, 0x20, 0x30, 0x30, 0xfe, 0x00, 0xfc, 0x20, 0x03, 0x00, 0x30, 0x30, 0x10, 0xfb,
+  0x00, 0xff, 0x20, 0xff, 0x10, 0xf9, 0x00, 0xfe, 0x20, 0xff, 0x00, 0x03, 0x20, 0x00, 0x00, 0x30,
+  0xfd, 0x20, 0xff, 0x30, 0xfe, 0x20, 0x05, 0x00, 0x20, 0x30, 0x30, 0x00, 0x00, 0xfe, 0x20, 0xfc,
+  0x00, 0xff, 0x20, 0x01, 0x30, 0x10, 0xfc, 0x00, 0xfe, 0x20, 0x02, 0x30, 0x10, 0x00, 0xfc, 0x20,
+  0xff, 0x00, 0x07, 0x20, 0x00, 0x00, 0x30, 0x20, 0x20, 0x10, 0x20, 0xfc, 0x00, 0x08, 0xcd, 0x00,
+  0xff, 0x30, 0xfe, 0x00, 0xfe, 0x30, 0xff, 0x00, 0xfe, 0x30, 0xfe, 0x00, 0xff, 0x30, 0xfe, 0x00,
+  0xfe, 0x30, 0xcd, 0x00, 0x08, 0xd7, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 0xf4, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0xd6, 0x00, 0x08, 0xd5, 0x00, 0xff, 0x30,
+  0x08, 0x20, 0x10, 0x10, 0x30, 0x20, 0x00, 0x10, 0x10, 0x30, 0xfe, 0x20, 0x00, 0x00, 0xfe, 0x10,
+  0x00, 0x30, 0xfe, 0x20, 0x00, 0x00, 0xfe, 0x10, 0x02, 0x30, 0x20, 0x20, 0xca, 0x00, 0x08, 0xd3,
+  0x00, 0xdf, 0x10, 0xd1, 0x00, 0x08, 0xd5, 0x00, 0xff, 0x30, 0x0a, 0x20, 0x10, 0x30, 0x20, 0x20,
+  0x00, 0x10, 0x30, 0x20, 0x20, 0x00, 0xfa, 0x10, 0xff, 0x30, 0xfe, 0x20, 0x02, 0x00, 0x10, 0x10,
+  0xfe, 0x30, 0x02, 0x00, 0x30, 0x30, 0xcf, 0x00, 0x00, 0x08, 0xec, 0x00, 0xff, 0x30, 0x00, 0x10,
+  0xfc, 0x00, 0xff, 0x20, 0x09, 0x30, 0x10, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x10, 0xfd,
+  0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x30, 0xfb, 0x00, 0x04, 0x30, 0x00, 0x00, 0x30, 0x30, 0xf7,
+  0x00, 0xff, 0x30, 0x03, 0x00, 0x20, 0x30, 0x30, 0xfd, 0x00, 0x06, 0x10, 0x30, 0x30, 0x00, 0x00,
+  0x30, 0x30, 0xfd, 0x00, 0xff, 0x30, 0xfe, 0x00, 0x06, 0x10, 0x30, 0x30, 0x00, 0x20, 0x30, 0x30,
+  0xea, 0x00, 0x08, 0xfb, 0x00, 0x01, 0x80, 0xc0, 0xfe, 0x00, 0xfd, 0xc0, 0xff, 0x00, 0x11, 0xc0,
+  0x40, 0xc0, 0x40, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x80, 0xc0,
+  0x40, 0xfe, 0xc0, 0xff, 0x00, 0x01, 0xc0, 0x40, 0xfb, 0x00, 0xff, 0xc0, 0xff, 0x80, 0x00, 0x00,
+  0xfd, 0x40, 0xff, 0xc0, 0x0e, 0x80, 0xc0, 0x00, 0xc0, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0,
+  0xc0, 0x40, 0xc0, 0x40, 0xfe, 0xc0, 0x06, 0x00, 0xc0, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0xfe, 0xc0,
+  0x00, 0x40, 0xfd, 0x00, 0xff, 0xc0, 0xfe, 0x80, 0xfd, 0x40, 0xfd, 0xc0, 0xfe, 0x00, 0xff, 0xc0,
+  0x0d, 0x40, 0x00, 0x40, 0xc0, 0x80, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x40, 0xfd,
+  0x00, 0x08, 0xcd, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xfe, 0x00,
+  0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xcd, 0x00, 0x08, 0xd7, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xc0,
+  0xc0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf4, 0x00, 0xff, 0xc0, 0x0c,
+  0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xd6, 0x00, 0x08,
+  0xd4, 0x00, 0xff, 0x40, 0x08, 0xc0, 0x80, 0x00, 0x40, 0x40, 0xc0, 0x80, 0x80, 0x00, 0xfe, 0x40,
+  0xff, 0xc0, 0xfe, 0x80, 0x0b, 0x00, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x40, 0xc0, 0xc0,
+  0x80, 0xcd, 0x00, 0x08, 0xd2, 0x00, 0xe0, 0x80, 0xd1, 0x00, 0x08, 0xd4, 0x00, 0xff, 0xc0, 0x06,
+  0x80, 0x00, 0x40, 0xc0, 0xc0, 0x80, 0x00, 0xfe, 0x40, 0xfe, 0xc0, 0xfb, 0x80, 0x07, 0x00, 0x40,
+  0x40, 0xc0, 0xc0, 0x80, 0x00, 0x40, 0xfe, 0xc0, 0xce, 0x00, 0x00, 0x08, 0xec, 0x00, 0xff, 0xc0,
+  0x01, 0x00, 0x40, 0xfc, 0xc0, 0xff, 0x40, 0xff, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xc0, 0xc0, 0xfa,
+  0x00, 0xff, 0xc0, 0x02, 0x00, 0xc0, 0xc0, 0xfb, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xc0, 0xc0, 0xf8,
+  0x00, 0x05, 0x80, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xfa, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xc0, 0xc0,
+  0xfd, 0x00, 0xff, 0xc0, 0xfc, 0x00, 0x03, 0x80, 0xc0, 0xc0, 0x40, 0xe9, 0x00, 0x10, 0xfb, 0x00,
+  0xff, 0x03, 0xff, 0x00, 0x05, 0x02, 0x03, 0x00, 0x03, 0x03, 0x02, 0xfe, 0x03, 0x02, 0x01, 0x00,
+  0x02, 0xfd, 0x03, 0x05, 0x02, 0x03, 0x03, 0x02, 0x00, 0x02, 0xfe, 0x03, 0x08, 0x01, 0x00, 0x03,
+  0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0xf6, 0x00, 0x08, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0x02, 0xfe, 0x03, 0x00, 0x02, 0xfd, 0x03, 0x01, 0x01, 0x00, 0xfd, 0x03, 0x0a, 0x01, 0x00,
+  0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0xf7, 0x00, 0x07, 0x02, 0x03, 0x01, 0x00,
+  0x00, 0x03, 0x00, 0x02, 0xfe, 0x03, 0xfc, 0x00, 0x01, 0x03, 0x02, 0xfe, 0x03, 0x02, 0x02, 0x01,
+  0x01, 0xfc, 0x00, 0x10, 0xcd, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xfe, 0x03,
+  0xfe, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xcd, 0x00, 0x10, 0xd7, 0x00, 0xff, 0x03, 0x0c,
+  0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0xf4, 0x00, 0xff,
+  0x03, 0x0c, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0xd6,
+  0x00, 0x10, 0xd1, 0x00, 0xff, 0x01, 0x07, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x03, 0x03, 0xfe,
+  0x02, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x03, 0xfe, 0x02, 0x08, 0x00, 0x01, 0x03, 0x03, 0x02, 0x00,
+  0x01, 0x03, 0x02, 0xcf, 0x00, 0x10, 0xd3, 0x00, 0xdf, 0x01, 0xd1, 0x00, 0x10, 0xd5, 0x00, 0xff,
+  0x03, 0x00, 0x01, 0xfe, 0x03, 0x05, 0x02, 0x00, 0x01, 0x01, 0x03, 0x03, 0xfb, 0x02, 0xff, 0x00,
+  0xfe, 0x01, 0xff, 0x03, 0x08, 0x02, 0x00, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0x03, 0xcf, 0x00,
+  0x00, 0x10, 0xec, 0x00, 0xfe, 0x03, 0xf7, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x03, 0xfb, 0x00,
+  0xff, 0x03, 0x03, 0x00, 0x03, 0x03, 0x02, 0xfd, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xff, 0x03, 0x00,
+  0x02, 0xfb, 0x00, 0x06, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0xfb, 0x00, 0xff, 0x03, 0xff,
+  0x00, 0xff, 0x03, 0x00, 0x02, 0xfe, 0x00, 0xff, 0x03, 0xfe, 0x00, 0x06, 0x02, 0x03, 0x03, 0x01,
+  0x00, 0x03, 0x02, 0xea, 0x00, 0x10, 0xfb, 0x00, 0xff, 0x0c, 0x02, 0x08, 0x0c, 0x04, 0xf9, 0x00,
+  0x00, 0x08, 0xfe, 0x0c, 0xe4, 0x00, 0x02, 0x08, 0x0c, 0x04, 0xf3, 0x00, 0x00, 0x04, 0xfc, 0x00,
+  0x00, 0x04, 0xed, 0x00, 0xff, 0x08, 0xff, 0x04, 0xf0, 0x00, 0x02, 0x04, 0x0c, 0x0c, 0xf9, 0x00,
+  0x10, 0xcd, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xff, 0x00, 0xfe, 0x0c, 0xfe, 0x00, 0xff,
+  0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xcd, 0x00, 0x10, 0xd7, 0x00, 0xff, 0x0c, 0x0c, 0x00, 0x0c, 0x0c,
+  0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xf4, 0x00, 0xff, 0x0c, 0x0c, 0x00,
+  0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0xd6, 0x00, 0x10, 0xcd,
+  0x00, 0xff, 0x04, 0xff, 0x0c, 0xff, 0x08, 0x00, 0x00, 0xfe, 0x04, 0xff, 0x0c, 0xff, 0x08, 0x0d,
+  0x00, 0x04, 0x04, 0x0c, 0x08, 0x08, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0xd1, 0x00,
+  0x10, 0xd2, 0x00, 0xe0, 0x08, 0xd1, 0x00, 0x10, 0xd7, 0x00, 0x07, 0x08, 0x0c, 0x04, 0x00, 0x08,
+  0x0c, 0x04, 0x00, 0xfe, 0x0c, 0xfe, 0x08, 0x00, 0x00, 0xfa, 0x04, 0xff, 0x0c, 0xff, 0x08, 0x0b,
+  0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x08, 0xd1, 0x00, 0x00, 0x10,
+  0xec, 0x00, 0xfe, 0x0c, 0xf7, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x04, 0xfc, 0x0c, 0x05, 0x00,
+  0x0c, 0x0c, 0x00, 0x00, 0x04, 0xf9, 0x0c, 0xfe, 0x00, 0x00, 0x04, 0xfa, 0x0c, 0xff, 0x04, 0xfe,
+  0x00, 0xff, 0x0c, 0x00, 0x00, 0xfc, 0x0c, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x04, 0xf7, 0x0c, 0x00,
+  0x04, 0xfe, 0x00, 0x03, 0x04, 0x0c, 0x0c, 0x08, 0xec, 0x00, 0x10, 0xfc, 0x00, 0x03, 0x20, 0x30,
+  0x30, 0x10, 0xf7, 0x00, 0xfe, 0x10, 0xe6, 0x00, 0xff, 0x20, 0x01, 0x30, 0x10, 0xd8, 0x00, 0x02,
+  0x20, 0x30, 0x10, 0xec, 0x00, 0xff, 0x10, 0xf9, 0x00, 0x10, 0xcd, 0x00, 0xff, 0x30, 0xfe, 0x00,
+  0xfe, 0x30, 0xff, 0x00, 0xfe, 0x30, 0xfe, 0x00, 0xff, 0x30, 0xfe, 0x00, 0xfe, 0x30, 0xcd, 0x00,
+  0x10, 0xd7, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x30, 0x30, 0xf4, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x30, 0x30, 0x00, 0x30, 0x30, 0xd6, 0x00, 0x10, 0xc8, 0x00, 0xfe, 0x10, 0x00, 0x30, 0xfe, 0x20,
+  0x10, 0x00, 0x10, 0x10, 0x30, 0x20, 0x20, 0x00, 0x10, 0x30, 0x20, 0x00, 0x30, 0x30, 0x00, 0x10,
+  0x30, 0x20, 0xd2, 0x00, 0x10, 0xd2, 0x00, 0xe0, 0x10, 0xd1, 0x00, 0x10, 0xd8, 0x00, 0x0e, 0x20,
+  0x30, 0x10, 0x00, 0x30, 0x30, 0x00, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30, 0x10, 0x10, 0xfa, 0x30,
+  0xff, 0x20, 0x0e, 0x00, 0x10, 0x10, 0x30, 0x20, 0x00, 0x10, 0x30, 0x20, 0x00, 0x30, 0x20, 0x00,
+  0x10, 0x30, 0xd1, 0x00, 0x00, 0x10, 0xd7, 0x00, 0x00, 0x10, 0xf3, 0x00, 0xff, 0x30, 0xf1, 0x00,
+  0xff, 0x30, 0xce, 0x00, 0x10, 0xd1, 0x00, 0xfe, 0x40, 0xd7, 0x00, 0xff, 0x40, 0xe0, 0x00, 0x10,
+  0xcd, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xfe, 0x00, 0xff, 0xc0,
+  0xfe, 0x00, 0xfe, 0xc0, 0xcd, 0x00, 0x10, 0xd7, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xc0, 0xc0, 0x00,
+  0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf4, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xc0,
+  0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xd6, 0x00, 0x10, 0xc2, 0x00,
+  0xff, 0x40, 0x10, 0xc0, 0x80, 0x80, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x80, 0x00, 0x40, 0xc0,
+  0x00, 0x40, 0xc0, 0x80, 0xd3, 0x00, 0x00, 0x10, 0xd8, 0x00, 0xff, 0xc0, 0x0e, 0x00, 0xc0, 0xc0,
+  0x00, 0x80, 0xc0, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0x40, 0x40, 0xfb, 0x00, 0x10, 0x40,
+  0xc0, 0xc0, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0x40, 0xc0, 0x80, 0x00, 0xc0, 0x80, 0x00, 0xc0, 0xc0,
+  0xd2, 0x00, 0x00, 0x10, 0xca, 0x00, 0x02, 0x80, 0xc0, 0xc0, 0xf0, 0x00, 0xff, 0xc0, 0xce, 0x00,
+  0x00, 0x20, 0xcd, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xfe, 0x03, 0xfe, 0x00,
+  0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xcd, 0x00, 0x20, 0xd7, 0x00, 0xff, 0x03, 0x0c, 0x00, 0x03,
+  0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0xf4, 0x00, 0xff, 0x03, 0x0c,
+  0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0xd6, 0x00, 0x20,
+  0xbf, 0x00, 0x0f, 0x01, 0x03, 0x03, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x03,
+  0x00, 0x03, 0x03, 0xd3, 0x00, 0x00, 0x20, 0xd8, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x03, 0x00, 0x02, 0x03, 0x00, 0x02, 0x03, 0x01, 0xf7, 0x00, 0x0e, 0x01, 0x03, 0x02, 0x00,
+  0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x01, 0x03, 0xd2, 0x00, 0x00, 0x20, 0xce,
+  0x00, 0xfd, 0x03, 0xff, 0x01, 0xef, 0x00, 0xff, 0x03, 0xce, 0x00, 0x00, 0x20, 0xcd, 0x00, 0xff,
+  0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xff, 0x00, 0xfe, 0x0c, 0xfe, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe,
+  0x0c, 0xcd, 0x00, 0x20, 0xd7, 0x00, 0xff, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xf5, 0x00, 0x0f, 0x08, 0x0c, 0x04, 0x00, 0x0c, 0x0c, 0x00,
+  0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xd6, 0x00, 0x20, 0xcd, 0x00, 0x00, 0x08,
+  0xf2, 0x00, 0x0d, 0x0c, 0x08, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x04,
+  0x0c, 0xd3, 0x00, 0x00, 0x20, 0xd8, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c,
+  0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0xf5, 0x00, 0xff, 0x0c, 0x0b, 0x00, 0x0c, 0x0c, 0x00, 0x0c,
+  0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x20, 0xcd, 0x00, 0xff,
+  0x30, 0xfe, 0x00, 0xfe, 0x30, 0xff, 0x00, 0xfe, 0x30, 0xfe, 0x00, 0xff, 0x30, 0xfe, 0x00, 0xfe,
+  0x30, 0xcd, 0x00, 0x20, 0xd7, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 0xf6, 0x00, 0x0f, 0x20, 0x30, 0x10, 0x00, 0x30, 0x30, 0x00,
+  0x20, 0x30, 0x10, 0x00, 0x30, 0x30, 0x00, 0x20, 0x30, 0xd5, 0x00, 0x20, 0xd0, 0x00, 0xff, 0x20,
+  0x03, 0x00, 0x10, 0x30, 0x20, 0xf4, 0x00, 0x0d, 0x30, 0x10, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30,
+  0x00, 0x30, 0x30, 0x00, 0x20, 0x30, 0xd3, 0x00, 0x00, 0x20, 0xd8, 0x00, 0x0e, 0x30, 0x00, 0x00,
+  0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x10, 0x30, 0x20, 0x10, 0x30, 0x20, 0xf7, 0x00, 0x0e, 0x20,
+  0x30, 0x00, 0x00, 0x30, 0x10, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x20, 0x30, 0xd2, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0xcd, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0,
+  0xfe, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xcd, 0x00, 0x20, 0xd7, 0x00, 0xff, 0xc0, 0x0c,
+  0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xfa, 0x00, 0xff,
+  0x80, 0xff, 0xc0, 0x0f, 0x40, 0x00, 0x80, 0xc0, 0x40, 0x00, 0x80, 0xc0, 0x40, 0x00, 0x80, 0xc0,
+  0x00, 0x00, 0xc0, 0x40, 0xd5, 0x00, 0x20, 0xd5, 0x00, 0x0c, 0x80, 0x00, 0x40, 0xc0, 0x80, 0x00,
+  0x40, 0xc0, 0x80, 0x00, 0x40, 0x40, 0xc0, 0xfe, 0x80, 0xfc, 0x00, 0xff, 0x80, 0x0e, 0xc0, 0x40,
+  0x00, 0x80, 0xc0, 0x00, 0x00, 0xc0, 0x40, 0x00, 0xc0, 0x40, 0x00, 0xc0, 0xc0, 0xd3, 0x00, 0x00,
+  0x20, 0xd8, 0x00, 0xff, 0xc0, 0x0f, 0x00, 0x40, 0xc0, 0x00, 0x00, 0xc0, 0x80, 0x00, 0x40, 0xc0,
+  0x80, 0x00, 0x40, 0xc0, 0x80, 0x80, 0xfd, 0x00, 0xff, 0x80, 0x0f, 0xc0, 0x40, 0x00, 0x80, 0xc0,
+  0x40, 0x00, 0x80, 0xc0, 0x00, 0x80, 0xc0, 0x40, 0x00, 0xc0, 0xc0, 0xd2, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0xcd, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xfe, 0x03, 0xfe, 0x00, 0xff,
+  0x03, 0xfe, 0x00, 0xfe, 0x03, 0xcd, 0x00, 0x40, 0xd7, 0x00, 0xff, 0x03, 0x0c, 0x00, 0x03, 0x03,
+  0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0xf8, 0x01, 0x10, 0x00, 0x02, 0x02,
+  0x03, 0x01, 0x01, 0x02, 0x03, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03, 0x01, 0xd4, 0x00,
+  0x40, 0xd8, 0x00, 0xff, 0x02, 0x0e, 0x00, 0x01, 0x03, 0x02, 0x00, 0x01, 0x03, 0x02, 0x00, 0x01,
+  0x03, 0x03, 0x02, 0x02, 0x00, 0xf9, 0x01, 0x0e, 0x00, 0x02, 0x02, 0x03, 0x01, 0x00, 0x02, 0x03,
+  0x01, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03, 0xd2, 0x00, 0x00, 0x40, 0xd7, 0x00, 0x0e, 0x03, 0x02,
+  0x00, 0x01, 0x03, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0xf9, 0x01, 0xff,
+  0x02, 0x0c, 0x03, 0x01, 0x01, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03, 0x01, 0x00, 0x03, 0x03, 0xd1,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0xcd, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xff, 0x00, 0xfe,
+  0x0c, 0xfe, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xcd, 0x00, 0x40, 0xd7, 0x00, 0xff, 0x0c,
+  0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0xf9, 0x08,
+  0xff, 0x0c, 0xff, 0x04, 0x0c, 0x00, 0x08, 0x0c, 0x0c, 0x04, 0x00, 0x08, 0x0c, 0x04, 0x00, 0x08,
+  0x0c, 0x04, 0xd3, 0x00, 0x40, 0xd7, 0x00, 0xff, 0x0c, 0x0a, 0x08, 0x04, 0x0c, 0x0c, 0x08, 0x00,
+  0x04, 0x0c, 0x08, 0x08, 0x00, 0xfe, 0x04, 0xfe, 0x0c, 0xff, 0x08, 0xfe, 0x0c, 0xfe, 0x04, 0x0b,
+  0x00, 0x08, 0x0c, 0x04, 0x00, 0x08, 0x0c, 0x04, 0x00, 0x08, 0x0c, 0x04, 0xd2, 0x00, 0x00, 0x40,
+  0xd6, 0x00, 0xff, 0x0c, 0x09, 0x00, 0x04, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x0c, 0x08, 0x00, 0xfe,
+  0x04, 0xff, 0x0c, 0x00, 0x08, 0xfe, 0x0c, 0xfe, 0x04, 0x0b, 0x00, 0x08, 0x08, 0x0c, 0x04, 0x00,
+  0x08, 0x0c, 0x04, 0x00, 0x0c, 0x0c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xcd, 0x00, 0xff, 0x30,
+  0xfe, 0x00, 0xfe, 0x30, 0xff, 0x00, 0xfe, 0x30, 0xfe, 0x00, 0xff, 0x30, 0xfe, 0x00, 0xfe, 0x30,
+  0xcd, 0x00, 0x40, 0xd7, 0x00, 0xff, 0x30, 0x0c, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x30, 0x30, 0xfb, 0x10, 0xff, 0x00, 0xfe, 0x20, 0xff, 0x30, 0x09, 0x10, 0x00,
+  0x20, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30, 0x10, 0xd1, 0x00, 0x40, 0xd6, 0x00, 0x0d, 0x10, 0x30,
+  0x30, 0x20, 0x00, 0x10, 0x30, 0x20, 0x20, 0x00, 0x10, 0x10, 0x30, 0x30, 0xf7, 0x20, 0xff, 0x30,
+  0xff, 0x10, 0x07, 0x00, 0x20, 0x30, 0x10, 0x10, 0x20, 0x30, 0x30, 0xd0, 0x00, 0x00, 0x40, 0xd5,
+  0x00, 0x0b, 0x10, 0x30, 0x20, 0x00, 0x10, 0x30, 0x20, 0x20, 0x00, 0x10, 0x10, 0x30, 0xfd, 0x20,
+  0xff, 0x00, 0xfd, 0x20, 0x0b, 0x30, 0x10, 0x10, 0x00, 0x20, 0x20, 0x30, 0x10, 0x00, 0x20, 0x30,
+  0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x40, 0xcd, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xff,
+  0x00, 0xfe, 0xc0, 0xfe, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xcd, 0x00, 0x40, 0xd7, 0x00,
+  0xff, 0xc0, 0x0c, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
+  0xf7, 0x40, 0x0a, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0x00, 0x80, 0xc0, 0x40, 0xcf, 0x00,
+  0x40, 0xd3, 0x00, 0x07, 0x40, 0xc0, 0x80, 0x80, 0x00, 0x40, 0x40, 0xc0, 0xfe, 0x80, 0xff, 0x00,
+  0xfa, 0x40, 0x00, 0x00, 0xfe, 0x80, 0x07, 0xc0, 0x40, 0x40, 0x00, 0x80, 0xc0, 0xc0, 0x40, 0xcf,
+  0x00, 0x00, 0x40, 0xd3, 0x00, 0x0b, 0x40, 0xc0, 0x80, 0x00, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x80,
+  0x00, 0x00, 0xfb, 0x40, 0xff, 0x00, 0xff, 0x80, 0xff, 0xc0, 0xff, 0x40, 0x03, 0x00, 0x80, 0xc0,
+  0x40, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcd, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xff,
+  0x00, 0xfe, 0x03, 0xfe, 0x00, 0xff, 0x03, 0xfe, 0x00, 0xfe, 0x03, 0xcd, 0x00, 0x80, 0xd7, 0x00,
+  0xff, 0x03, 0x0c, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03,
+  0xfb, 0x02, 0xfe, 0x03, 0xfd, 0x01, 0x05, 0x00, 0x02, 0x02, 0x03, 0x01, 0x01, 0xcd, 0x00, 0x80,
+  0xd1, 0x00, 0xff, 0x01, 0xff, 0x03, 0xff, 0x02, 0x00, 0x00, 0xfc, 0x01, 0xfd, 0x03, 0xfc, 0x01,
+  0x05, 0x00, 0x02, 0x02, 0x03, 0x03, 0x01, 0xcc, 0x00, 0x00, 0x80, 0xd1, 0x00, 0xff, 0x01, 0x03,
+  0x03, 0x02, 0x02, 0x00, 0xfe, 0x01, 0xf9, 0x03, 0xfe, 0x01, 0x05, 0x00, 0x02, 0x02, 0x03, 0x01,
+  0x01, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcd, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xff,
+  0x00, 0xfe, 0x0c, 0xfe, 0x00, 0xff, 0x0c, 0xfe, 0x00, 0xfe, 0x0c, 0xcd, 0x00, 0x80, 0xd7, 0x00,
+  0xff, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x0c,
+  0xf6, 0x08, 0xff, 0x0c, 0xff, 0x04, 0xc9, 0x00, 0x80, 0xcd, 0x00, 0xfd, 0x04, 0xff, 0x0c, 0xf9,
+  0x08, 0xfe, 0x0c, 0xfe, 0x04, 0xc9, 0x00, 0x00, 0x80, 0xcd, 0x00, 0xff, 0x04, 0xff, 0x0c, 0xf7,
+  0x08, 0xff, 0x0c, 0xfe, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcd, 0x00, 0xff, 0x10, 0xfe,
+  0x00, 0xfe, 0x10, 0xff, 0x00, 0xfe, 0x10, 0xfe, 0x00, 0xff, 0x10, 0xfe, 0x00, 0xfe, 0x10, 0xcd,
+  0x00, 0x80, 0xd7, 0x00, 0xff, 0x10, 0x0a, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0xf6, 0x10, 0xc3, 0x00, 0x00, 0x00, 0x80, 0xc8, 0x00, 0xf9, 0x10, 0xc2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
@@ -69,3 +69,25 @@ const uint8_t D_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// D_BITMAP_DATA in SSD1306 page order, PackBits (287 bytes): unpackBits() into display.getBuffer()
+const uint8_t D_BITMAP_RLE[] PROGMEM = {
+  0xd7, 0x00, 0xff, 0xf0, 0xff, 0x30, 0xef, 0xb0, 0xff, 0x20, 0xfe, 0x60, 0x04, 0x40, 0xc0, 0xc0,
+  0x80, 0x80, 0xa1, 0x00, 0xff, 0xff, 0x08, 0x00, 0xff, 0xff, 0x01, 0xf9, 0xfd, 0x0d, 0x0d, 0xed,
+  0xf7, 0x2d, 0xff, 0x6d, 0x10, 0x69, 0x49, 0xdb, 0x9b, 0xb2, 0x36, 0x64, 0xcd, 0x99, 0x3b, 0x73,
+  0xe6, 0xcc, 0x98, 0x30, 0xe0, 0xc0, 0xa9, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x01, 0xff, 0x03, 0x13, 0x02, 0x06, 0x0c,
+  0x1c, 0x39, 0xf3, 0x86, 0x1c, 0xf9, 0xe3, 0x0e, 0xfc, 0xf1, 0x07, 0x3e, 0xf8, 0x83, 0x0f, 0xfc,
+  0xe0, 0xac, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xac, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xac, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfa, 0x00, 0xff, 0x80, 0xff,
+  0xc0, 0x10, 0x60, 0x38, 0x9f, 0xc7, 0x70, 0x3f, 0x8f, 0xe0, 0x7c, 0x1f, 0x80, 0xf0, 0x3f, 0x03,
+  0xe0, 0x7f, 0x0f, 0xac, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x59, 0xff, 0x49, 0x11, 0x6d, 0x6c, 0x26, 0xb6, 0xb3, 0xd9,
+  0xcd, 0x6e, 0x67, 0x33, 0x99, 0xcc, 0x67, 0x33, 0x18, 0x0e, 0x07, 0x01, 0xaa, 0x00, 0xff, 0x1f,
+  0x0c, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0xfb, 0x1a,
+  0xfe, 0x1b, 0xff, 0x09, 0xff, 0x0d, 0x05, 0x04, 0x06, 0x02, 0x03, 0x01, 0x01, 0xcd, 0x00
+
+};
@@ -69,3 +69,9 @@ const uint8_t DASH_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// DASH_BITMAP_DATA in SSD1306 page order, PackBits (26 bytes): unpackBits() into display.getBuffer()
+const uint8_t DASH_BITMAP_RLE[] PROGMEM = {
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xd3, 0x00, 0x00, 0x10, 0xe0, 0x90, 0xa3, 0x00, 0x00, 0x01,
+  0xe0, 0x19, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xd1, 0x00
+
+};
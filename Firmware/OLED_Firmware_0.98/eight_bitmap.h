@@ -69,3 +69,26 @@ const uint8_t EIGHT_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// EIGHT_BITMAP_DATA in SSD1306 page order, PackBits (299 bytes): unpackBits() into display.getBuffer()
+const uint8_t EIGHT_BITMAP_RLE[] PROGMEM = {
+  0xd0, 0x00, 0x09, 0x80, 0xc0, 0xc0, 0x60, 0x60, 0x20, 0xb0, 0xb0, 0x90, 0x90, 0xfd, 0xd0, 0xff,
+  0x90, 0xff, 0xb0, 0x05, 0x20, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0x9f, 0x00, 0x24, 0xe0, 0x70, 0x1c,
+  0xce, 0xe6, 0x3b, 0x99, 0xcc, 0x66, 0x32, 0x9b, 0xd9, 0x6d, 0x6d, 0x24, 0xb4, 0xb6, 0x96, 0x96,
+  0xb6, 0xb4, 0x24, 0x6d, 0x6d, 0xd9, 0x9b, 0x32, 0x66, 0xcc, 0x99, 0x33, 0xe7, 0xce, 0x1c, 0x70,
+  0xe0, 0x80, 0xa7, 0x00, 0x25, 0xff, 0x83, 0x00, 0xff, 0x87, 0x00, 0xfe, 0xff, 0x01, 0x7c, 0xff,
+  0x03, 0x38, 0xfe, 0x87, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0xc7, 0xfe, 0x78, 0x03,
+  0xff, 0xfc, 0x01, 0xc7, 0xfe, 0x00, 0x87, 0xff, 0x00, 0x01, 0xff, 0xa7, 0x00, 0x11, 0x03, 0x0f,
+  0x3c, 0xf1, 0xe7, 0x9c, 0x38, 0x63, 0xe6, 0xcc, 0x99, 0x33, 0x66, 0x6c, 0x49, 0xdb, 0xda, 0xd6,
+  0xfe, 0x96, 0x10, 0x97, 0xb7, 0xb7, 0x24, 0x6e, 0x6f, 0xc9, 0xdc, 0x9e, 0x33, 0x79, 0xfc, 0xc7,
+  0xf3, 0x38, 0x0f, 0x03, 0xa8, 0x00, 0x10, 0xe0, 0xf8, 0x1c, 0xc7, 0xf3, 0x39, 0x8f, 0xe7, 0x73,
+  0x1e, 0xcc, 0xed, 0x39, 0x9b, 0xdb, 0x72, 0x76, 0xfd, 0x36, 0x12, 0x34, 0x24, 0x6d, 0xcd, 0xd9,
+  0x9b, 0x33, 0xe6, 0xcc, 0x19, 0x73, 0xe6, 0x8c, 0x39, 0xe3, 0x87, 0x1c, 0xf8, 0xc0, 0xa9, 0x00,
+  0x11, 0xff, 0xc0, 0x00, 0x7f, 0xf1, 0x00, 0x3f, 0xff, 0x80, 0x1e, 0x7f, 0xe0, 0x9e, 0x3f, 0x61,
+  0xc0, 0x80, 0x80, 0xfd, 0x00, 0xff, 0x80, 0x0f, 0xc0, 0x61, 0x3f, 0x8e, 0xc0, 0x7f, 0x1f, 0x80,
+  0xff, 0x3f, 0x80, 0xff, 0x7f, 0x00, 0xe1, 0xff, 0xa8, 0x00, 0x25, 0x03, 0x0e, 0x1c, 0x31, 0x67,
+  0xce, 0x98, 0x33, 0x67, 0x6e, 0xcc, 0xd9, 0x93, 0xb6, 0x26, 0x25, 0x6d, 0x6d, 0x49, 0x4d, 0x6d,
+  0x6d, 0x25, 0x26, 0xb6, 0x93, 0xd9, 0xc9, 0x6c, 0x67, 0x33, 0x98, 0xce, 0x67, 0x31, 0x1c, 0x0f,
+  0x03, 0xa1, 0x00, 0xff, 0x01, 0x06, 0x03, 0x02, 0x06, 0x04, 0x0d, 0x0d, 0x09, 0xf9, 0x1b, 0x08,
+  0x09, 0x0d, 0x0d, 0x04, 0x06, 0x06, 0x03, 0x01, 0x01, 0xcb, 0x00
+
+};
@@ -1,6 +1,11 @@
 #!/usr/bin/env node
 /**
  * Generate Arduino PROGMEM headers from 128x64 PNGs.
+ * Each header carries the image twice:
+ *   *_DATA - row-major, MSB first (Adafruit drawBitmap)
+ *   *_RLE  - SSD1306 page-major, PackBits compressed (firmware unpackBits()
+ *            expands it straight into the display buffer)
+ * It also writes the animation containers listed in ANIMS (see encodeAnim).
  * Usage: node generate_bitmaps.js assets
  */
 const fs = require('fs');
@@ -12,13 +17,26 @@ const IN_DIR = process.argv[2] ? path.resolve(process.cwd(), process.argv[2]) :
 const OUT_DIR = process.cwd();
 
 const FILES = [
-  { names: ['T.png'], out: 't_bitmap.h', sym: { W: 'T_BITMAP_W', H: 'T_BITMAP_H', DATA: 'T_BITMAP_DATA' } },
-  { names: ['D.png'], out: 'd_bitmap.h', sym: { W: 'D_BITMAP_W', H: 'D_BITMAP_H', DATA: 'D_BITMAP_DATA' } },
-  { names: ['S.png'], out: 's_bitmap.h', sym: { W: 'S_BITMAP_W', H: 'S_BITMAP_H', DATA: 'S_BITMAP_DATA' } },
-  { names: ['dash.png', '-.png', 'dash.jpg', '-.jpg'], out: 'dash_bitmap.h', sym: { W: 'DASH_BITMAP_W', H: 'DASH_BITMAP_H', DATA: 'DASH_BITMAP_DATA' } },
-  { names: ['eight.png', '8.png', 'eight.jpg', '8.jpg'], out: 'eight_bitmap.h', sym: { W: 'EIGHT_BITMAP_W', H: 'EIGHT_BITMAP_H', DATA: 'EIGHT_BITMAP_DATA' } },
+  { names: ['T.png'], out: 't_bitmap.h', sym: { W: 'T_BITMAP_W', H: 'T_BITMAP_H', DATA: 'T_BITMAP_DATA', RLE: 'T_BITMAP_RLE' } },
+  { names: ['D.png'], out: 'd_bitmap.h', sym: { W: 'D_BITMAP_W', H: 'D_BITMAP_H', DATA: 'D_BITMAP_DATA', RLE: 'D_BITMAP_RLE' } },
+  { names: ['S.png'], out: 's_bitmap.h', sym: { W: 'S_BITMAP_W', H: 'S_BITMAP_H', DATA: 'S_BITMAP_DATA', RLE: 'S_BITMAP_RLE' } },
+  { names: ['dash.png', '-.png', 'dash.jpg', '-.jpg'], out: 'dash_bitmap.h', sym: { W: 'DASH_BITMAP_W', H: 'DASH_BITMAP_H', DATA: 'DASH_BITMAP_DATA', RLE: 'DASH_BITMAP_RLE' } },
+  { names: ['eight.png', '8.png', 'eight.jpg', '8.jpg'], out: 'eight_bitmap.h', sym: { W: 'EIGHT_BITMAP_W', H: 'EIGHT_BITMAP_H', DATA: 'EIGHT_BITMAP_DATA', RLE: 'EIGHT_BITMAP_RLE' } },
   // Allow either scribble.png or "digital scribble strip.jpg"
-  { names: ['scribble.png', 'digital scribble strip.jpg'], out: 'scribble_bitmap.h', sym: { W: 'SCRIBBLE_BITMAP_W', H: 'SCRIBBLE_BITMAP_H', DATA: 'SCRIBBLE_BITMAP_DATA' } },
+  { names: ['scribble.png', 'digital scribble strip.jpg'], out: 'scribble_bitmap.h', sym: { W: 'SCRIBBLE_BITMAP_W', H: 'SCRIBBLE_BITMAP_H', DATA: 'SCRIBBLE_BITMAP_DATA', RLE: 'SCRIBBLE_BITMAP_RLE' } },
+  { names: ['playoptix.png'], out: 'playoptix_bitmap.h', sym: { W: 'PLAYOPTIX_BITMAP_W', H: 'PLAYOPTIX_BITMAP_H', DATA: 'PLAYOPTIX_BITMAP_DATA', RLE: 'PLAYOPTIX_BITMAP_RLE' } },
+];
+
+// Animations, one still per screen (FILES header name, null = blank).
+// If assets/<dir>/ exists its "<screen>-<frame>.png" files are used as the
+// frames; otherwise the stills are revealed top-down, rowsPerFrame rows per
+// frame. A reveal frame touches one page per screen, ~1 KB on the bus for
+// all 8 screens, which keeps 30 fps inside a 400 kHz I2C budget.
+const ANIMS = [
+  {
+    dir: 'boot', out: 'boot_anim.h', sym: 'BOOT_ANIM', periodMs: 33, rowsPerFrame: 2,
+    screens: ['scribble_bitmap.h', 't_bitmap.h', 'd_bitmap.h', 's_bitmap.h', 'dash_bitmap.h', 'eight_bitmap.h', null, 'playoptix_bitmap.h'],
+  },
 ];
 
 function to1BPP(png) {
@@ -48,6 +66,98 @@ function to1BPP(png) {
   return out;
 }
 
+// Re-pack row-major 1bpp into the SSD1306 GDDRAM layout used by the
+// Adafruit buffer: 8 pages of W bytes, each byte a vertical strip of 8
+// pixels with the top pixel in bit 0.
+function toPages(rows, W, H) {
+  const bytesPerRow = Math.ceil(W / 8);
+  const out = Buffer.alloc(W * Math.ceil(H / 8));
+  for (let y = 0; y < H; y++) {
+    for (let x = 0; x < W; x++) {
+      if (rows[y * bytesPerRow + (x >> 3)] & (0x80 >> (x & 7))) {
+        out[(y >> 3) * W + x] |= (1 << (y & 7));
+      }
+    }
+  }
+  return out;
+}
+
+// PackBits: a header byte n, then
+//   n = 0..127   -> n+1 literal bytes follow
+//   n = -1..-127 -> one byte follows, repeated 1-n times
+// Runs of 3+ equal bytes break a literal; the logos are mostly 0x00 pages.
+function toPackBits(buf) {
+  const out = [];
+  let i = 0;
+  while (i < buf.length) {
+    let run = 1;
+    while (i + run < buf.length && run < 128 && buf[i + run] === buf[i]) run++;
+    if (run >= 2) {
+      out.push(257 - run, buf[i]);
+      i += run;
+      continue;
+    }
+    const start = i;
+    while (i < buf.length && i - start < 128) {
+      if (i + 2 < buf.length && buf[i] === buf[i + 1] && buf[i] === buf[i + 2]) break;
+      i++;
+    }
+    out.push(i - start - 1);
+    for (let k = start; k < i; k++) out.push(buf[k]);
+  }
+  return Buffer.from(out);
+}
+
+// Animation container, frames x screens records in play order:
+//   mask byte (bit p = page p changed since the previous frame)
+//   then, for each set bit, PackBits of the 128-byte XOR of that page
+// Frame 0 is XORed against a blank screen, so it doubles as the keyframe.
+function encodeAnim(frames /* [screen][frame] page-major buffers */, frameCount) {
+  const out = [];
+  const prev = frames.map(() => Buffer.alloc(1024));
+  for (let f = 0; f < frameCount; f++) {
+    for (let s = 0; s < frames.length; s++) {
+      const seq = frames[s];
+      const cur = seq.length ? seq[Math.min(f, seq.length - 1)] : prev[s];
+      let mask = 0;
+      const chunks = [];
+      for (let p = 0; p < 8; p++) {
+        const x = Buffer.alloc(128);
+        let changed = false;
+        for (let i = 0; i < 128; i++) {
+          x[i] = cur[p * 128 + i] ^ prev[s][p * 128 + i];
+          if (x[i]) changed = true;
+        }
+        if (changed) { mask |= 1 << p; chunks.push(toPackBits(x)); }
+      }
+      out.push(mask);
+      for (const c of chunks) for (const b of c) out.push(b);
+      prev[s] = cur;
+    }
+  }
+  return Buffer.from(out);
+}
+
+function revealFrames(still, rowsPerFrame) {
+  const frames = [];
+  for (let rows = rowsPerFrame; rows < 64 + rowsPerFrame; rows += rowsPerFrame) {
+    const f = Buffer.alloc(1024);
+    for (let y = 0; y < Math.min(rows, 64); y++) {
+      const bit = 1 << (y & 7);
+      for (let x = 0; x < 128; x++) f[(y >> 3) * 128 + x] |= still[(y >> 3) * 128 + x] & bit;
+    }
+    frames.push(f);
+  }
+  return frames;
+}
+
+function emitAnim(dstPath, a, screens, frameCount, data) {
+  const content = `#pragma once\n#include <Arduino.h>\n// ${frameCount} frames x ${screens} screens, mask + PackBits XOR pages per record\n` +
+    `#define ${a.sym}_FRAMES ${frameCount}\n#define ${a.sym}_SCREENS ${screens}\n#define ${a.sym}_PERIOD_MS ${a.periodMs}\n` +
+    emitArray(a.sym, data);
+  fs.writeFileSync(dstPath, content, 'utf8');
+}
+
 function toHeaderBytes(buf) {
   const parts = [];
   for (let i = 0; i < buf.length; i++) {
@@ -57,9 +167,16 @@ function toHeaderBytes(buf) {
   return parts;
 }
 
-function emitHeader(dstPath, sym, width, height, bytes) {
+function emitArray(name, bytes) {
   const arr = toHeaderBytes(bytes);
-  const content = `#pragma once\n#include <Arduino.h>\n#define ${sym.W} ${width}\n#define ${sym.H} ${height}\nconst uint8_t ${sym.DATA}[] PROGMEM = {\n${arr.map((x, i) => (i % 16 === 0 ? '  ' : '') + x + (i < arr.length - 1 ? ',' : '') + ((i % 16 === 15 || i === arr.length - 1) ? '\n' : ' ')).join('')}\n};\n`;
+  return `const uint8_t ${name}[] PROGMEM = {\n${arr.map((x, i) => (i % 16 === 0 ? '  ' : '') + x + (i < arr.length - 1 ? ',' : '') + ((i % 16 === 15 || i === arr.length - 1) ? '\n' : ' ')).join('')}\n};\n`;
+}
+
+function emitHeader(dstPath, sym, width, height, bytes, rle) {
+  const content = `#pragma once\n#include <Arduino.h>\n#define ${sym.W} ${width}\n#define ${sym.H} ${height}\n` +
+    emitArray(sym.DATA, bytes) +
+    `// ${sym.DATA} in SSD1306 page order, PackBits (${rle.length} bytes): unpackBits() into display.getBuffer()\n` +
+    emitArray(sym.RLE, rle);
   fs.writeFileSync(dstPath, content, 'utf8');
 }
 
@@ -87,6 +204,7 @@ function decodeImage(srcPath) {
     process.exit(1);
   }
   console.log(`[INFO] Generating headers from: ${IN_DIR}`);
+  const stills = {};   // header name -> page-major image, for ANIMS
   for (const f of FILES) {
     // Find first available candidate name
     let src = null;
@@ -101,12 +219,43 @@ function decodeImage(srcPath) {
     try {
       const img = decodeImage(src);
       const packed = to1BPP(img);
+      const pages = toPages(packed, img.width, img.height);
+      const rle = toPackBits(pages);
+      stills[f.out] = pages;
       const outPath = path.join(OUT_DIR, f.out);
-      emitHeader(outPath, f.sym, img.width, img.height, packed);
-      console.log(`[OK] Wrote ${path.basename(outPath)} (${packed.length} bytes)`);
+      emitHeader(outPath, f.sym, img.width, img.height, packed, rle);
+      console.log(`[OK] Wrote ${path.basename(outPath)} (${packed.length} raw, ${rle.length} packed)`);
     } catch (e) {
       console.error(`[ERROR] Failed to process ${path.basename(src)}: ${e.message}`);
     }
   }
+  for (const a of ANIMS) {
+    try {
+      const frameDir = path.join(IN_DIR, a.dir);
+      let frames;
+      if (exists(frameDir)) {
+        frames = a.screens.map(() => []);
+        for (const name of fs.readdirSync(frameDir).sort()) {
+          const m = /^(\d+)-(\d+)\.(png|jpe?g)$/i.exec(name);
+          if (!m || +m[1] >= frames.length) continue;
+          const img = decodeImage(path.join(frameDir, name));
+          frames[+m[1]][+m[2]] = toPages(to1BPP(img), img.width, img.height);
+        }
+        frames = frames.map(seq => seq.filter(Boolean));
+      } else {
+        frames = a.screens.map(h => {
+          if (!h) return [];
+          if (!stills[h]) { console.warn(`[WARN] ${a.out}: ${h} not generated, screen left blank`); return []; }
+          return revealFrames(stills[h], a.rowsPerFrame);
+        });
+      }
+      const frameCount = Math.max(1, ...frames.map(seq => seq.length));
+      const data = encodeAnim(frames, frameCount);
+      emitAnim(path.join(OUT_DIR, a.out), a, frames.length, frameCount, data);
+      console.log(`[OK] Wrote ${a.out} (${frameCount} frames, ${data.length} bytes)`);
+    } catch (e) {
+      console.error(`[ERROR] Failed to build ${a.out}: ${e.message}`);
+    }
+  }
   console.log('[DONE] Header generation complete.');
 })();
@@ -0,0 +1,183 @@
+#!/usr/bin/env node
+/**
+ * Generate utf8_glyphs.h, the glyph store drawTrackName() uses for
+ * non-ASCII track names.
+ * Glyphs are 5x8, one byte per row, MSB left (the layout of the e-paper
+ * Font8 table in fonts.h), sorted by codepoint so the firmware can binary
+ * search them. Printable ASCII comes straight from Font8; accented Latin
+ * letters are composed from a Font8 base letter and a mark (Unicode NFD);
+ * the few letters and symbols that do not decompose are drawn in SPECIALS.
+ * U+FFFD is the box shown for anything not in the store (CJK, emoji, ...).
+ * Usage: node generate_glyphs.js [path/to/font8.c]
+ */
+const fs = require('fs');
+const path = require('path');
+
+const FONT8 = process.argv[2] ||
+  path.resolve(__dirname, '../../Hardware Components/E-Paper_code/Arduino/epd1in54/font8.c');
+const OUT = path.resolve(process.cwd(), 'utf8_glyphs.h');
+
+// Latin-1 Supplement and Latin Extended-A
+const RANGES = [[0x00A0, 0x00FF], [0x0100, 0x017F]];
+
+// Marks are two rows: above ones sit on rows 0-1, below ones on rows 6-7
+const MARKS = {
+  0x0300: { above: ['.#...', '..#..'] },   // grave
+  0x0301: { above: ['...#.', '..#..'] },   // acute
+  0x0302: { above: ['..#..', '.#.#.'] },   // circumflex
+  0x0303: { above: ['.##.#', '#.##.'] },   // tilde
+  0x0304: { above: ['.###.', '.....'] },   // macron
+  0x0306: { above: ['#...#', '.###.'] },   // breve
+  0x0307: { above: ['..#..', '.....'] },   // dot above
+  0x0308: { above: ['.#.#.', '.....'] },   // diaeresis
+  0x030A: { above: ['.###.', '.#.#.'] },   // ring
+  0x030B: { above: ['..#.#', '.#.#.'] },   // double acute
+  0x030C: { above: ['.#.#.', '..#..'] },   // caron
+  0x0327: { below: ['..#..', '.##..'] },   // cedilla
+  0x0328: { below: ['..#..', '...##'] },   // ogonek
+};
+
+const SPECIALS = {
+  0x00A1: ['..#..', '.....', '..#..', '..#..', '..#..', '..#..', '.....', '.....'], // ¡
+  0x00A2: ['..#..', '.###.', '.#...', '.#...', '.###.', '..#..', '.....', '.....'], // ¢
+  0x00A3: ['..##.', '.#...', '###..', '.#...', '.#...', '#####', '.....', '.....'], // £
+  0x00A5: ['#...#', '.#.#.', '#####', '..#..', '#####', '..#..', '.....', '.....'], // ¥
+  0x00A7: ['.###.', '.#...', '.###.', '.#.#.', '.###.', '...#.', '.###.', '.....'], // §
+  0x00A9: ['.###.', '#...#', '#.#.#', '##..#', '#.#.#', '#...#', '.###.', '.....'], // ©
+  0x00AB: ['.....', '.....', '..#.#', '.#.#.', '#.#..', '.#.#.', '..#.#', '.....'], // «
+  0x00AE: ['.###.', '#...#', '###.#', '##.##', '##.##', '#...#', '.###.', '.....'], // ®
+  0x00B0: ['.##..', '#..#.', '.##..', '.....', '.....', '.....', '.....', '.....'], // °
+  0x00B1: ['..#..', '..#..', '#####', '..#..', '..#..', '#####', '.....', '.....'], // ±
+  0x00B5: ['.....', '.....', '#..#.', '#..#.', '#..#.', '###.#', '#....', '#....'], // µ
+  0x00B7: ['.....', '.....', '.....', '..#..', '.....', '.....', '.....', '.....'], // ·
+  0x00BB: ['.....', '.....', '#.#..', '.#.#.', '..#.#', '.#.#.', '#.#..', '.....'], // »
+  0x00BF: ['..#..', '.....', '..#..', '.#...', '#...#', '.###.', '.....', '.....'], // ¿
+  0x00C6: ['.####', '#.#..', '#.##.', '###..', '#.#..', '#.###', '.....', '.....'], // Æ
+  0x00D0: ['###..', '.#.#.', '.#..#', '###.#', '.#.#.', '###..', '.....', '.....'], // Ð
+  0x00D7: ['.....', '#...#', '.#.#.', '..#..', '.#.#.', '#...#', '.....', '.....'], // ×
+  0x00D8: ['..###', '.#.##', '.#.#.', '.##.#', '##..#', '###..', '.....', '.....'], // Ø
+  0x00DE: ['##...', '.###.', '.#..#', '.#..#', '.###.', '##...', '.....', '.....'], // Þ
+  0x00DF: ['.##..', '#..#.', '#.#..', '#..#.', '#..#.', '#.##.', '.....', '.....'], // ß
+  0x00E6: ['.....', '.....', '##.#.', '..###', '####.', '##.##', '.....', '.....'], // æ
+  0x00F0: ['.#.#.', '..#..', '.#.#.', '...#.', '.####', '.###.', '.....', '.....'], // ð
+  0x00F7: ['.....', '..#..', '.....', '#####', '.....', '..#..', '.....', '.....'], // ÷
+  0x00F8: ['.....', '.....', '..###', '.#.##', '.##.#', '###..', '.....', '.....'], // ø
+  0x00FE: ['##...', '.#...', '.###.', '.#..#', '.#..#', '.###.', '.#...', '###..'], // þ
+  0x0110: ['###..', '.#.#.', '.#..#', '###.#', '.#.#.', '###..', '.....', '.....'], // Đ
+  0x0111: ['...#.', '..###', '.###.', '#..#.', '#..#.', '.####', '.....', '.....'], // đ
+  0x0126: ['##.##', '#####', '.###.', '.#.#.', '.#.#.', '##.##', '.....', '.....'], // Ħ
+  0x0127: ['##...', '###..', '.#...', '.###.', '.#..#', '##..#', '.....', '.....'], // ħ
+  0x0131: ['.....', '.....', '.##..', '..#..', '..#..', '.###.', '.....', '.....'], // ı
+  0x0141: ['###..', '.#...', '.##..', '##...', '.#..#', '#####', '.....', '.....'], // Ł
+  0x0142: ['.##..', '..#..', '..##.', '.##..', '..#..', '.###.', '.....', '.....'], // ł
+  0x014A: ['##..#', '.##.#', '.#.##', '.#..#', '.#..#', '##..#', '....#', '...#.'], // Ŋ
+  0x014B: ['.....', '.....', '####.', '.#..#', '.#..#', '##..#', '....#', '...#.'], // ŋ
+  0x0152: ['.####', '#.#..', '#.##.', '#.#..', '#.#..', '.####', '.....', '.....'], // Œ
+  0x0153: ['.....', '.....', '.#.#.', '#.###', '#.#..', '.#.##', '.....', '.....'], // œ
+  0x0237: ['.....', '.....', '.###.', '...#.', '...#.', '...#.', '...#.', '###..'], // ȷ
+  0x2013: ['.....', '.....', '.....', '####.', '.....', '.....', '.....', '.....'], // –
+  0x2014: ['.....', '.....', '.....', '#####', '.....', '.....', '.....', '.....'], // —
+  0x2018: ['..#..', '.#...', '.##..', '.....', '.....', '.....', '.....', '.....'], // ‘
+  0x2019: ['..##.', '...#.', '..#..', '.....', '.....', '.....', '.....', '.....'], // ’
+  0x201C: ['.#.#.', '#.#..', '##.#.', '.....', '.....', '.....', '.....', '.....'], // “
+  0x201D: ['.##.#', '..#.#', '.#.#.', '.....', '.....', '.....', '.....', '.....'], // ”
+  0x2022: ['.....', '.....', '.###.', '.###.', '.###.', '.....', '.....', '.....'], // •
+  0x2026: ['.....', '.....', '.....', '.....', '.....', '#.#.#', '.....', '.....'], // …
+  0x20AC: ['..###', '.#...', '####.', '.#...', '####.', '.#...', '..###', '.....'], // €
+  0x266A: ['..#..', '..##.', '..#.#', '..#..', '.##..', '###..', '.#...', '.....'], // ♪
+  0x266B: ['.####', '.#..#', '.#..#', '.#..#', '##.##', '##.##', '.....', '.....'], // ♫
+  0x266D: ['.#...', '.#...', '.##..', '.#.#.', '.#.#.', '.##..', '.....', '.....'], // ♭
+  0x266F: ['.#.#.', '#####', '.#.#.', '.#.#.', '#####', '.#.#.', '.....', '.....'], // ♯
+  0xFFFD: ['#####', '#...#', '#...#', '#...#', '#...#', '#####', '.....', '.....'], // missing
+};
+
+// Bases whose dot would collide with a mark
+const DOTLESS = { i: 0x0131, j: 0x0237 };
+
+function loadFont8(file) {
+  const src = fs.readFileSync(file, 'utf8');
+  const body = src.slice(src.indexOf('Font8_Table'));
+  const bytes = [...body.matchAll(/0x([0-9A-Fa-f]{2}),?\s*\/\//g)].map(m => parseInt(m[1], 16));
+  if (bytes.length !== 95 * 8) throw new Error(`${file}: expected 95 glyphs, got ${bytes.length / 8}`);
+  const glyphs = new Map();
+  for (let c = 0x20; c <= 0x7E; c++) glyphs.set(c, bytes.slice((c - 0x20) * 8, (c - 0x20) * 8 + 8));
+  return glyphs;
+}
+
+const rowBits = s => [...s].reduce((b, ch, i) => (ch === '#' ? b | (0x80 >> i) : b), 0);
+const fromArt = art => art.map(rowBits);
+
+// Squeeze rows 0-5 of a tall glyph into rows 2-5 so a mark fits above it,
+// dropping rows that repeat a neighbour first, then the ones nearest the middle
+function squeeze(g) {
+  const rows = g.slice(0, 6);
+  while (rows.length > 4) {
+    let drop = -1;
+    for (const i of [2, 3, 1, 4]) {
+      if (rows[i] === rows[i - 1] || rows[i] === rows[i + 1]) { drop = i; break; }
+    }
+    if (drop < 0) drop = rows.length === 6 ? 1 : 3;
+    rows.splice(drop, 1);
+  }
+  return [0, 0, ...rows, g[6], g[7]];
+}
+
+function compose(font, glyphs, cp) {
+  const parts = [...String.fromCodePoint(cp).normalize('NFD')].map(c => c.codePointAt(0));
+  if (parts.length !== 2 || !MARKS[parts[1]]) return null;
+  let base = parts[0];
+  if (DOTLESS[String.fromCodePoint(base)]) base = DOTLESS[String.fromCodePoint(base)];
+  const src = glyphs.get(base) || font.get(base);
+  if (!src) return null;
+  const mark = MARKS[parts[1]];
+  let g = src.slice();
+  if (mark.above) {
+    if (g[0] || g[1]) g = squeeze(g);
+    g[0] |= rowBits(mark.above[0]);
+    g[1] |= rowBits(mark.above[1]);
+  } else {
+    if (g[6] || g[7]) return null;
+    g[6] = rowBits(mark.below[0]);
+    g[7] = rowBits(mark.below[1]);
+  }
+  return g;
+}
+
+function main() {
+  const font = loadFont8(FONT8);
+  const glyphs = new Map(font);
+  for (const [cp, art] of Object.entries(SPECIALS)) glyphs.set(Number(cp), fromArt(art));
+  glyphs.set(0x00A0, font.get(0x20));
+  for (const [lo, hi] of RANGES) {
+    for (let cp = lo; cp <= hi; cp++) {
+      if (glyphs.has(cp)) continue;
+      const g = compose(font, glyphs, cp);
+      if (g) glyphs.set(cp, g);
+    }
+  }
+
+  const cps = [...glyphs.keys()].sort((a, b) => a - b);
+  const hex = b => '0x' + b.toString(16).padStart(2, '0');
+  const lines = cps.map(cp => {
+    const name = cp === 0x5C ? 'backslash' : String.fromCodePoint(cp);
+    return `  { 0x${cp.toString(16).toUpperCase().padStart(4, '0')}, { ${glyphs.get(cp).map(hex).join(', ')} } }, // ${name}`;
+  });
+  const out = [
+    '#pragma once',
+    '// Generated by generate_glyphs.js from the e-paper Font8 table - do not edit',
+    '#include <Arduino.h>',
+    '#define UTF8_GLYPH_W 5',
+    '#define UTF8_GLYPH_H 8',
+    `#define UTF8_GLYPH_COUNT ${cps.length}`,
+    'typedef struct { uint16_t cp; uint8_t rows[UTF8_GLYPH_H]; } Utf8Glyph;',
+    'const Utf8Glyph UTF8_GLYPHS[] PROGMEM = {',
+    ...lines,
+    '};',
+    '',
+  ].join('\n');
+  fs.writeFileSync(OUT, out);
+  const extra = cps.filter(cp => cp > 0x7E).length;
+  console.log(`Wrote ${path.basename(OUT)}: ${cps.length} glyphs (${extra} beyond ASCII), ${cps.length * 10} bytes`);
+}
+
+main();
@@ -0,0 +1,3 @@
+// The sketch, compiled as an ordinary translation unit against stubs/
+#include <Arduino.h>
+#include "../OLED_Firmware_0.98.ino"
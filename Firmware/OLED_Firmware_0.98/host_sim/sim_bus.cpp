@@ -0,0 +1,326 @@
+#include "sim_bus.h"
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <driver/i2c_master.h>
+#include <esp_timer.h>
+
+#include <queue>
+#include <vector>
+#include <sys/stat.h>
+
+namespace sim {
+
+Counters bus;
+
+// Rough per-transaction driver cost on top of the bits themselves
+static const uint32_t WIRE_SETUP_US  = 30;
+static const uint32_t ASYNC_SETUP_US = 10;
+
+static const int PANEL_W = 128, PANEL_H = 64, PANEL_BYTES = PANEL_W * PANEL_H / 8;
+
+struct Panel {
+  uint8_t ram[PANEL_BYTES] = {};
+  bool    on = false, inverted = false;
+  uint8_t contrast = 0x7F;
+  uint8_t colStart = 0, colEnd = PANEL_W - 1, pageStart = 0, pageEnd = 7;
+  uint8_t col = 0, page = 0;
+  uint8_t cmd = 0, args[8] = {}, argc = 0, argNeed = 0;   // command being collected
+};
+
+static Panel   panels[32];
+static uint8_t muxSel[4] = {};
+static int     muxCount  = 1;
+static bool    asyncOk   = true;
+static uint64_t now = 0, busFree = 0, seq = 0;
+
+struct Event {
+  uint64_t at, order;
+  std::function<void()> fn;
+  bool operator>(const Event& o) const { return at != o.at ? at > o.at : order > o.order; }
+};
+static std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+
+uint64_t nowUs() { return now; }
+uint64_t busIdleAt() { return busFree; }
+int  muxes() { return muxCount; }
+void setMuxes(int n) { muxCount = n < 1 ? 1 : n > 4 ? 4 : n; }
+void setAsyncAvailable(bool on) { asyncOk = on; }
+bool asyncAvailable() { return asyncOk; }
+
+bool runNextEvent() {
+  if (events.empty()) return false;
+  Event e = events.top();
+  events.pop();
+  if (e.at > now) now = e.at;
+  e.fn();
+  return true;
+}
+
+void advanceTo(uint64_t us) {
+  while (!events.empty() && events.top().at <= us) runNextEvent();
+  if (us > now) now = us;
+}
+
+void settle() {
+  while (runNextEvent()) {}
+  if (busFree > now) now = busFree;
+}
+
+// ---------------------------------------------------------------- SSD1306 decode
+static uint8_t argCount(uint8_t c) {
+  switch (c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+    case 0xD9: case 0xDA: case 0xDB: return 1;
+    case 0x21: case 0x22: case 0xA3: return 2;
+    case 0x29: case 0x2A: return 5;
+    case 0x26: case 0x27: return 6;
+    default: return 0;
+  }
+}
+
+static void applyCommand(Panel& p) {
+  switch (p.cmd) {
+    case 0x21: p.colStart = p.args[0] & 0x7F; p.colEnd = p.args[1] & 0x7F; p.col = p.colStart; break;
+    case 0x22: p.pageStart = p.args[0] & 7; p.pageEnd = std::min<uint8_t>(p.args[1], 7); p.page = p.pageStart; break;
+    case 0x81: p.contrast = p.args[0]; break;
+    case 0xA6: p.inverted = false; break;
+    case 0xA7: p.inverted = true; break;
+    case 0xAE: p.on = false; break;
+    case 0xAF: p.on = true; break;
+  }
+}
+
+static void commandByte(Panel& p, uint8_t b) {
+  if (p.argNeed) {
+    p.args[p.argc++] = b;
+    if (--p.argNeed == 0) applyCommand(p);
+    return;
+  }
+  p.cmd = b; p.argc = 0; p.argNeed = argCount(b);
+  if (!p.argNeed) applyCommand(p);
+}
+
+static void dataByte(Panel& p, uint8_t b) {
+  p.ram[p.page * PANEL_W + p.col] = b;
+  if (++p.col > p.colEnd) {
+    p.col = p.colStart;
+    if (++p.page > p.pageEnd) p.page = p.pageStart;
+  }
+}
+
+static void panelWrite(Panel& p, const uint8_t* d, size_t n) {
+  size_t i = 0;
+  while (i < n) {
+    uint8_t ctrl = d[i++];
+    bool data = ctrl & 0x40;
+    if (!(ctrl & 0x80)) {   // Co=0: the rest of the transaction is one stream
+      for (; i < n; i++) data ? dataByte(p, d[i]) : commandByte(p, d[i]);
+      return;
+    }
+    if (i < n) { uint8_t b = d[i++]; data ? dataByte(p, b) : commandByte(p, b); }
+  }
+}
+
+// ---------------------------------------------------------------- bus
+uint8_t transfer(uint8_t addr, const uint8_t* data, size_t len, uint32_t hz, bool blocking,
+                 std::function<void()> done) {
+  bool ack = false;
+  if (addr >= 0x70 && addr < 0x70 + muxCount) {
+    ack = true;
+    if (len) muxSel[addr - 0x70] = data[len - 1];
+  } else if (addr == 0x3C) {
+    for (int s = 0; s < muxCount * 8; s++) {
+      if (muxSel[s / 8] & (1 << (s % 8))) { ack = true; panelWrite(panels[s], data, len); }
+    }
+  }
+
+  size_t onWire = ack ? len + 1 : 1;
+  uint64_t bits = 9 * onWire + 2;
+  uint64_t dur  = (bits * 1000000ULL + hz - 1) / (hz ? hz : 100000) + (blocking ? WIRE_SETUP_US : ASYNC_SETUP_US);
+  uint64_t start = std::max(now, busFree);
+  busFree = start + dur;
+  bus.bytes += onWire;
+  bus.txns++;
+  bus.busUs += dur;
+  if (!ack) bus.nacks++;
+
+  if (blocking) advanceTo(busFree);
+  else events.push({busFree, seq++, done ? done : [] {}});
+  return ack ? 0 : 2;
+}
+
+// ---------------------------------------------------------------- images
+static bool lit(int s, int x, int y) {
+  const Panel& p = panels[s];
+  if (!p.on) return false;
+  bool b = p.ram[(y / 8) * PANEL_W + x] & (1 << (y & 7));
+  return b != p.inverted;
+}
+
+// Lit pixels in snapshots follow the contrast, so dimmed panels look dimmed
+static uint8_t shade(int s) {
+  return (uint8_t)std::min(0xFF, 0x50 + 0xAF * panels[s].contrast / 0xCF);
+}
+
+static uint32_t crcTable[256];
+static uint32_t crc32(uint32_t c, const uint8_t* d, size_t n) {
+  if (!crcTable[1]) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t v = i;
+      for (int k = 0; k < 8; k++) v = v & 1 ? 0xEDB88320u ^ (v >> 1) : v >> 1;
+      crcTable[i] = v;
+    }
+  }
+  c = ~c;
+  while (n--) c = crcTable[(c ^ *d++) & 0xFF] ^ (c >> 8);
+  return ~c;
+}
+
+static void put32(std::vector<uint8_t>& v, uint32_t x) {
+  v.push_back(x >> 24); v.push_back(x >> 16); v.push_back(x >> 8); v.push_back(x);
+}
+
+static void chunk(FILE* f, const char* type, const std::vector<uint8_t>& body) {
+  std::vector<uint8_t> c;
+  put32(c, (uint32_t)body.size());
+  c.insert(c.end(), type, type + 4);
+  c.insert(c.end(), body.begin(), body.end());
+  put32(c, crc32(0, c.data() + 4, c.size() - 4));
+  fwrite(c.data(), 1, c.size(), f);
+}
+
+// 8-bit grayscale PNG using stored (uncompressed) deflate blocks
+static bool writePng(const std::string& path, int w, int h, const std::vector<uint8_t>& px) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  fwrite(sig, 1, 8, f);
+
+  std::vector<uint8_t> ihdr;
+  put32(ihdr, w); put32(ihdr, h);
+  ihdr.insert(ihdr.end(), {8, 0, 0, 0, 0});
+  chunk(f, "IHDR", ihdr);
+
+  std::vector<uint8_t> raw;
+  for (int y = 0; y < h; y++) {
+    raw.push_back(0);
+    raw.insert(raw.end(), px.begin() + y * w, px.begin() + (y + 1) * w);
+  }
+  std::vector<uint8_t> z = {0x78, 0x01};
+  uint32_t a = 1, b = 0;
+  for (uint8_t v : raw) { a = (a + v) % 65521; b = (b + a) % 65521; }
+  for (size_t off = 0; off < raw.size() || off == 0; off += 65535) {
+    size_t n = std::min<size_t>(65535, raw.size() - off);
+    z.push_back(off + n >= raw.size() ? 1 : 0);
+    z.push_back(n & 0xFF); z.push_back(n >> 8);
+    z.push_back(~n & 0xFF); z.push_back((~n >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + off, raw.begin() + off + n);
+    if (off + n >= raw.size()) break;
+  }
+  put32(z, (b << 16) | a);
+  chunk(f, "IDAT", z);
+  chunk(f, "IEND", {});
+  return fclose(f) == 0;
+}
+
+bool snapshot(const std::string& dir, const std::string& name) {
+  mkdir(dir.c_str(), 0755);
+  const int screens = muxCount * 8, gap = 4, cols = 8, rows = muxCount;
+  const int W = cols * PANEL_W + (cols + 1) * gap, H = rows * PANEL_H + (rows + 1) * gap;
+  std::vector<uint8_t> px(W * H, 0x40);
+  bool ok = true;
+
+  for (int s = 0; s < screens; s++) {
+    int ox = gap + (s % cols) * (PANEL_W + gap), oy = gap + (s / cols) * (PANEL_H + gap);
+    std::string pbm = dir + "/" + name + "_" + std::to_string(s) + ".pbm";
+    FILE* f = fopen(pbm.c_str(), "wb");
+    if (f) fprintf(f, "P4\n%d %d\n", PANEL_W, PANEL_H);
+    for (int y = 0; y < PANEL_H; y++) {
+      uint8_t row[PANEL_W / 8] = {};
+      for (int x = 0; x < PANEL_W; x++) {
+        bool on = lit(s, x, y);
+        px[(oy + y) * W + ox + x] = on ? shade(s) : 0x00;
+        if (!on) row[x / 8] |= 0x80 >> (x & 7);   // PBM: 1 = black
+      }
+      if (f) fwrite(row, 1, sizeof(row), f);
+    }
+    ok &= f && fclose(f) == 0;
+  }
+  return writePng(dir + "/" + name + ".png", W, H, px) && ok;
+}
+
+}  // namespace sim
+
+// ---------------------------------------------------------------- Arduino timing
+unsigned long millis() { return (unsigned long)(sim::nowUs() / 1000); }
+unsigned long micros() { return (unsigned long)sim::nowUs(); }
+int64_t esp_timer_get_time() { return (int64_t)sim::nowUs(); }
+void delay(unsigned long ms) { sim::advanceTo(sim::nowUs() + ms * 1000ULL); }
+void delayMicroseconds(unsigned int us) { sim::advanceTo(sim::nowUs() + us); }
+void yield() {}
+
+// ---------------------------------------------------------------- Wire
+TwoWire Wire;
+
+bool TwoWire::begin(int, int, uint32_t freq) { if (freq) hz_ = freq; return true; }
+bool TwoWire::end() { return true; }
+bool TwoWire::setClock(uint32_t hz) { hz_ = hz; return true; }
+
+uint8_t TwoWire::endTransmission(bool) {
+  uint8_t rc = sim::transfer(addr_, buf_, len_, hz_, true);
+  len_ = 0;
+  return rc;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t, bool) {
+  sim::transfer(addr, nullptr, 0, hz_, true);
+  return 0;   // no readable devices on the simulated bus
+}
+
+// ---------------------------------------------------------------- i2c_master
+struct SimI2cBus {
+  size_t depth;
+  size_t inFlight = 0;
+};
+
+struct SimI2cDev {
+  SimI2cBus* bus;
+  uint8_t    addr;
+  uint32_t   hz;
+  i2c_master_callback_t cb = nullptr;
+  void*      arg = nullptr;
+};
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t* cfg, i2c_master_bus_handle_t* out) {
+  if (!sim::asyncAvailable()) return ESP_FAIL;
+  *out = new SimI2cBus{cfg->trans_queue_depth ? cfg->trans_queue_depth : 1};
+  return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus) { delete bus; return ESP_OK; }
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t* cfg,
+                                    i2c_master_dev_handle_t* out) {
+  *out = new SimI2cDev{bus, (uint8_t)cfg->device_address, cfg->scl_speed_hz};
+  return ESP_OK;
+}
+
+esp_err_t i2c_master_register_event_callbacks(i2c_master_dev_handle_t dev,
+                                              const i2c_master_event_callbacks_t* cbs, void* arg) {
+  dev->cb = cbs->on_trans_done;
+  dev->arg = arg;
+  return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t* data, size_t len, int) {
+  SimI2cBus* b = dev->bus;
+  while (b->inFlight >= b->depth && sim::runNextEvent()) {}   // driver queue full: wait
+  b->inFlight++;
+  sim::transfer(dev->addr, data, len, dev->hz, false, [dev, b] {
+    b->inFlight--;
+    i2c_master_event_data_t ev = {0};
+    if (dev->cb) dev->cb(dev, &ev, dev->arg);
+  });
+  return ESP_OK;
+}
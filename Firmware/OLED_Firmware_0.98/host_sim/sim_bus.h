@@ -0,0 +1,48 @@
+#pragma once
+// Simulated time and I2C bus for the host build.
+//
+// One clock (microseconds) drives millis()/delay() and the bus. Transfers
+// are charged 9 bits per byte (address included) plus start/stop at the
+// clock they were issued with. Wire transfers block the caller until the
+// last bit is out; i2c_master transfers queue behind whatever is on the bus
+// and complete later in simulated time, firing the driver callback.
+//
+// Devices on the bus: TCA9548A muxes at 0x70.. and one SSD1306 at 0x3C per
+// mux channel. Panels keep their own GDDRAM, addressing window, invert and
+// on/off state, decoded from the byte stream, so snapshots show what the
+// glass would show rather than what the sketch meant to draw.
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <string>
+
+namespace sim {
+
+struct Counters {
+  uint64_t bytes = 0;   // bytes on the wire, address bytes included
+  uint64_t txns  = 0;   // START..STOP transactions
+  uint64_t nacks = 0;
+  uint64_t busUs = 0;   // time the bus was busy
+};
+
+extern Counters bus;
+
+uint64_t nowUs();
+void     advanceTo(uint64_t us);   // runs every completion due by then
+bool     runNextEvent();           // jump to the next completion; false if none pending
+void     settle();                 // run until nothing is left on the bus
+uint64_t busIdleAt();
+
+void setMuxes(int n);              // 1..4 TCA9548As, 8 panels each
+int  muxes();
+void setAsyncAvailable(bool on);   // false: i2c_new_master_bus fails (Wire fallback)
+bool asyncAvailable();
+
+// Returns 0 on ACK, 2 on address NACK (Wire endTransmission codes)
+uint8_t transfer(uint8_t addr, const uint8_t* data, size_t len, uint32_t hz,
+                 bool blocking, std::function<void()> done = nullptr);
+
+// <dir>/<name>.png with every panel tiled, plus <dir>/<name>_<n>.pbm each
+bool snapshot(const std::string& dir, const std::string& name);
+
+}  // namespace sim
@@ -0,0 +1,2 @@
+/* Glyph table for the host Adafruit_GFX stand-in, shared with the e-paper examples */
+#include "../../../Hardware Components/E-Paper_code/Arduino/epd1in54/font8.c"
@@ -0,0 +1,147 @@
+// tds8_sim: run OLED_Firmware_0.98.ino on Linux against stubs/.
+//
+//   tds8_sim [--muxes N] [--wire] [--boot-ms MS] [--out DIR] [--quiet] [script|-]
+//
+// The script is read line by line (stdin by default):
+//   <text>          sent to the firmware over Serial, then one loop() pass;
+//                   reported as an op with its I2C bytes and latency
+//   @wait <ms>      keep running loop() for <ms> of simulated time
+//   @snap <name>    write <out>/<name>.png (all panels) and .pbm per panel
+//   @stats          print bus totals so far
+//   # ...           comment
+// A final snapshot is written as <out>/final.png, after a summary line with
+// p50/p99 op latency and I2C bytes per op across the whole script.
+#include <Arduino.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <strings.h>
+#include "sim_bus.h"
+
+void setup();
+void loop();
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static std::string outDir = "sim_out";
+
+static uint32_t cpuMhz = 160;
+bool setCpuFrequencyMhz(uint32_t mhz) { cpuMhz = mhz; return true; }
+uint32_t getCpuFrequencyMhz() { return cpuMhz; }
+
+void EspClass::restart() {
+  printf("SIM restart requested, stopping\n");
+  sim::snapshot(outDir, "final");
+  exit(0);
+}
+
+const char* esp_err_to_name(esp_err_t err) {
+  switch (err) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    default: return "ESP_FAIL";
+  }
+}
+
+long random(long max) { return max > 0 ? ::random() % max : 0; }
+long random(long min, long max) { return max > min ? min + random(max - min) : min; }
+void randomSeed(unsigned long seed) { srandom(seed); }
+
+// Keep the firmware's loop() turning over for ms of simulated time
+static void runFor(uint64_t ms) {
+  uint64_t end = sim::nowUs() + ms * 1000;
+  while (sim::nowUs() < end) {
+    loop();
+    sim::advanceTo(std::min(sim::nowUs() + 1000, end));
+  }
+}
+
+static std::vector<uint64_t> opLatency;
+static uint64_t opBytes = 0;
+
+static uint64_t report(const char* what, const std::string& label, const sim::Counters& before, uint64_t t0) {
+  uint64_t done = std::max(sim::busIdleAt(), t0);
+  printf("SIM %s \"%s\" i2c_bytes=%llu txns=%llu nacks=%llu latency_us=%llu\n", what, label.c_str(),
+         (unsigned long long)(sim::bus.bytes - before.bytes), (unsigned long long)(sim::bus.txns - before.txns),
+         (unsigned long long)(sim::bus.nacks - before.nacks), (unsigned long long)(done - t0));
+  return done - t0;
+}
+
+static void summary() {
+  if (opLatency.empty()) return;
+  std::vector<uint64_t> l = opLatency;
+  std::sort(l.begin(), l.end());
+  size_t n = l.size();
+  printf("SIM summary ops=%zu p50_us=%llu p99_us=%llu max_us=%llu i2c_bytes_per_op=%llu\n", n,
+         (unsigned long long)l[(n - 1) * 50 / 100], (unsigned long long)l[(n - 1) * 99 / 100],
+         (unsigned long long)l[n - 1], (unsigned long long)(opBytes / n));
+}
+
+static void usage() {
+  fprintf(stderr, "usage: tds8_sim [--muxes N] [--wire] [--boot-ms MS] [--out DIR] [--quiet] [script|-]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  std::string script = "-";
+  uint64_t bootMs = 3000;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--muxes" && i + 1 < argc) sim::setMuxes(atoi(argv[++i]));
+    else if (a == "--wire") sim::setAsyncAvailable(false);
+    else if (a == "--boot-ms" && i + 1 < argc) bootMs = strtoull(argv[++i], nullptr, 10);
+    else if (a == "--out" && i + 1 < argc) outDir = argv[++i];
+    else if (a == "--quiet") Serial.echo = false;
+    else if (a[0] == '-' && a != "-") usage();
+    else script = a;
+  }
+
+  FILE* in = script == "-" ? stdin : fopen(script.c_str(), "r");
+  if (!in) { perror(script.c_str()); return 1; }
+
+  sim::Counters before = sim::bus;
+  setup();
+  runFor(bootMs);
+  sim::settle();
+  report("boot", std::to_string(bootMs) + "ms", before, 0);
+
+  char line[1024];
+  while (fgets(line, sizeof(line), in)) {
+    std::string s = line;
+    while (!s.empty() && (s.back() == '\n' || s.back() == '\r')) s.pop_back();
+    size_t b = s.find_first_not_of(" \t");
+    if (b == std::string::npos || s[b] == '#') continue;
+    s = s.substr(b);
+
+    if (s[0] == '@') {
+      std::string cmd = s.substr(1, s.find(' ') - 1);
+      std::string arg = s.find(' ') == std::string::npos ? "" : s.substr(s.find(' ') + 1);
+      if (cmd == "wait") runFor(strtoull(arg.c_str(), nullptr, 10));
+      else if (cmd == "snap") sim::snapshot(outDir, arg.empty() ? "snap" : arg);
+      else if (cmd == "stats")
+        printf("SIM stats i2c_bytes=%llu txns=%llu nacks=%llu bus_ms=%.1f sim_ms=%.1f\n",
+               (unsigned long long)sim::bus.bytes, (unsigned long long)sim::bus.txns,
+               (unsigned long long)sim::bus.nacks, sim::bus.busUs / 1000.0, sim::nowUs() / 1000.0);
+      else fprintf(stderr, "SIM unknown directive: %s\n", s.c_str());
+      continue;
+    }
+
+    before = sim::bus;
+    uint64_t t0 = sim::nowUs();
+    Serial.feed(s + "\n");
+    loop();
+    sim::settle();
+    uint64_t lat = report("op", s, before, t0);
+    if (strncasecmp(s.c_str(), "bench", 5) != 0) {   // BENCH prints its own numbers
+      opLatency.push_back(lat);
+      opBytes += sim::bus.bytes - before.bytes;
+    }
+  }
+
+  sim::settle();
+  summary();
+  if (!sim::snapshot(outDir, "final")) fprintf(stderr, "SIM could not write %s/final.png\n", outDir.c_str());
+  return 0;
+}
@@ -0,0 +1,124 @@
+// Cooperative FreeRTOS subset for the host build.
+//
+// Tasks are ucontext coroutines. A task runs as soon as it is created or
+// notified and keeps the CPU until it blocks, the way a higher-priority
+// task pre-empts loop() on the single-core ESP32-C3. A task blocked on a
+// semaphore hands the CPU back and is resumed from the give (normally the
+// bus completion "ISR"). loop() itself blocking on an empty semaphore just
+// advances simulated time to the next completion. Runs are deterministic.
+#include <Arduino.h>
+#include <ucontext.h>
+#include <vector>
+#include "sim_bus.h"
+
+struct SimTask;
+
+struct SimSem {
+  UBaseType_t count, max;
+  SimTask*    waiter = nullptr;
+};
+
+struct SimTask {
+  ucontext_t  ctx;
+  ucontext_t* back = nullptr;   // context that resumed us
+  void (*fn)(void*);
+  void*       arg;
+  uint32_t    notify = 0;
+  bool        waiting = false;
+  std::vector<char> stack;
+};
+
+static SimTask* current = nullptr;
+
+static void resume(SimTask* t) {
+  ucontext_t here;
+  SimTask* prev = current;
+  current = t;
+  t->back = &here;
+  swapcontext(&here, &t->ctx);
+  current = prev;
+}
+
+static void block() {
+  current->waiting = true;
+  swapcontext(&current->ctx, current->back);
+  current->waiting = false;
+}
+
+static void trampoline() {
+  current->fn(current->arg);
+  for (;;) block();   // a returning task just never runs again
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initial) {
+  return new SimSem{initial, maxCount};
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new SimSem{1, 1}; }
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t s) { return s->count; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  while (!s->count) {
+    if (!wait) return pdFALSE;
+    if (current) {
+      s->waiter = current;
+      block();
+    } else if (!sim::runNextEvent()) {
+      return pdFALSE;   // nothing left that could give it
+    }
+  }
+  s->count--;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  if (s->count >= s->max) return pdFALSE;
+  s->count++;
+  SimTask* t = s->waiter;
+  if (t && t != current && t->waiting) {
+    s->waiter = nullptr;
+    resume(t);
+  }
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+  return xSemaphoreGive(s);
+}
+
+BaseType_t xTaskCreate(void (*fn)(void*), const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* out) {
+  SimTask* t = new SimTask;
+  t->fn = fn;
+  t->arg = arg;
+  t->stack.resize(256 * 1024);
+  getcontext(&t->ctx);
+  t->ctx.uc_stack.ss_sp = t->stack.data();
+  t->ctx.uc_stack.ss_size = t->stack.size();
+  t->ctx.uc_link = nullptr;
+  makecontext(&t->ctx, trampoline, 0);
+  if (out) *out = t;
+  resume(t);   // runs up to its first block
+  return pdPASS;
+}
+
+void xTaskNotifyGive(TaskHandle_t t) {
+  t->notify++;
+  if (t->waiting && current != t) resume(t);
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+  xTaskNotifyGive(t);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+  if (!current) return 0;   // loop() context: nothing to wait for
+  while (!current->notify) block();
+  uint32_t v = current->notify;
+  current->notify = clearOnExit ? 0 : v - 1;
+  return v;
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
@@ -0,0 +1,116 @@
+#include "Adafruit_GFX.h"
+
+// Font8 from the e-paper examples: 8 rows per glyph, 5 px wide, MSB left,
+// printable ASCII from ' '.
+extern "C" const uint8_t Font8_Table[];
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+  for (;;) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    int16_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  int16_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r;
+  drawPixel(x0, y0 + r, color); drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color); drawPixel(x0 - r, y0, color);
+  while (x < y) {
+    if (f >= 0) { y--; ddy += 2; f += ddy; }
+    x++; ddx += 2; f += ddx;
+    drawPixel(x0 + x, y0 + y, color); drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color); drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color); drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color); drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  for (int16_t y = -r; y <= r; y++) {
+    int16_t dx = (int16_t)sqrt((double)(r * r - y * y));
+    drawFastHLine(x0 - dx, y0 + y, 2 * dx + 1, color);
+  }
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t, uint16_t color) {
+  drawRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+  int16_t bw = (w + 7) / 8;
+  for (int16_t j = 0; j < h; j++)
+    for (int16_t i = 0; i < w; i++)
+      if (bitmap[j * bw + i / 8] & (0x80 >> (i & 7))) drawPixel(x + i, y + j, color);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  const uint8_t* g = (c >= ' ' && c <= '~') ? Font8_Table + (c - ' ') * 8 : nullptr;
+  for (int8_t i = 0; i < 6; i++) {
+    for (int8_t j = 0; j < 8; j++) {
+      bool on = g && i < 5 && (g[j] & (0x80 >> i));
+      if (!on && bg == color) continue;
+      uint16_t col = on ? color : bg;
+      if (size == 1) drawPixel(x + i, y + j, col);
+      else fillRect(x + i * size, y + j * size, size, size, col);
+    }
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize * 8;
+  } else if (c != '\r') {
+    if (wrap && cursor_x + textsize * 6 > _width) {
+      cursor_x = 0;
+      cursor_y += textsize * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += textsize * 6;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::getTextBounds(const char* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+  int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+  *x1 = x; *y1 = y; *w = *h = 0;
+  for (; s && *s; s++) {
+    char c = *s;
+    if (c == '\n') { x = 0; y += textsize * 8; continue; }
+    if (c == '\r') continue;
+    if (wrap && x + textsize * 6 > _width) { x = 0; y += textsize * 8; }
+    int16_t x2 = x + textsize * 6 - 1, y2 = y + textsize * 8 - 1;
+    if (x2 > maxx) maxx = x2;
+    if (y2 > maxy) maxy = y2;
+    if (x < minx) minx = x;
+    if (y < miny) miny = y;
+    x += textsize * 6;
+  }
+  if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+  if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
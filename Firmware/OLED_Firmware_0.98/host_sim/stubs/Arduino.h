@@ -0,0 +1,262 @@
+#pragma once
+// Host stand-in for the ESP32 Arduino core: just enough of String, Print,
+// Serial, timing and FreeRTOS for OLED_Firmware_0.98.ino to build and run
+// on Linux. Time is simulated (see sim_bus.h); nothing here touches hardware.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <deque>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define DEC 10
+#define HEX 16
+
+using std::min;
+using std::max;
+
+// XIAO ESP32-C3 default I2C pins
+#define SDA 6
+#define SCL 7
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// ---------------------------------------------------------------- String
+class String {
+public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v, unsigned char base = DEC) : s_(fmtInt(v, base)) {}
+  explicit String(unsigned int v, unsigned char base = DEC) : s_(fmtUInt(v, base)) {}
+  explicit String(long v, unsigned char base = DEC) : s_(fmtInt(v, base)) {}
+  explicit String(unsigned long v, unsigned char base = DEC) : s_(fmtUInt(v, base)) {}
+  explicit String(float v, unsigned int decimals = 2) : String((double)v, decimals) {}
+  explicit String(double v, unsigned int decimals = 2) {
+    char b[48]; snprintf(b, sizeof(b), "%.*f", (int)decimals, v); s_ = b;
+  }
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  const char* c_str() const { return s_.c_str(); }
+  void reserve(unsigned int n) { s_.reserve(n); }
+
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return s_[i]; }
+  void setCharAt(unsigned int i, char c) { if (i < s_.size()) s_[i] = c; }
+
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, std::min<size_t>(to, s_.size()) - from));
+  }
+  int indexOf(char c, unsigned int from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const String& s, unsigned int from = 0) const { return pos(s_.find(s.s_, from)); }
+  int indexOf(const char* s, unsigned int from = 0) const { return pos(s_.find(s, from)); }
+  int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+  int lastIndexOf(const String& s) const { return pos(s_.rfind(s.s_)); }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool equalsIgnoreCase(const String& o) const {
+    if (s_.size() != o.s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++) if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    return true;
+  }
+
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  void toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (auto& c : s_) c = (char)toupper((unsigned char)c); }
+  void trim() {
+    size_t a = 0, b = s_.size();
+    while (a < b && isspace((unsigned char)s_[a])) a++;
+    while (b > a && isspace((unsigned char)s_[b - 1])) b--;
+    s_ = s_.substr(a, b - a);
+  }
+  void remove(unsigned int idx) { if (idx < s_.size()) s_.erase(idx); }
+  void remove(unsigned int idx, unsigned int n) { if (idx < s_.size()) s_.erase(idx, n); }
+  void replace(const String& from, const String& to) {
+    if (from.s_.empty()) return;
+    for (size_t p = 0; (p = s_.find(from.s_, p)) != std::string::npos; p += to.s_.size()) s_.replace(p, from.s_.size(), to.s_);
+  }
+  void replace(char from, char to) { for (auto& c : s_) if (c == from) c = to; }
+  void toCharArray(char* buf, unsigned int n) const {
+    if (!n) return;
+    size_t k = std::min<size_t>(n - 1, s_.size()); memcpy(buf, s_.data(), k); buf[k] = 0;
+  }
+  bool concat(const String& o) { s_ += o.s_; return true; }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(int v) { s_ += fmtInt(v, DEC); return *this; }
+  String& operator+=(unsigned int v) { s_ += fmtUInt(v, DEC); return *this; }
+  String& operator+=(long v) { s_ += fmtInt(v, DEC); return *this; }
+  String& operator+=(unsigned long v) { s_ += fmtUInt(v, DEC); return *this; }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+
+  const std::string& std() const { return s_; }
+
+private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  static std::string fmtUInt(unsigned long v, unsigned char base) {
+    char b[40]; snprintf(b, sizeof(b), base == HEX ? "%lx" : "%lu", v); return b;
+  }
+  static std::string fmtInt(long v, unsigned char base) {
+    if (base == HEX) return fmtUInt((unsigned long)v, base);
+    char b[40]; snprintf(b, sizeof(b), "%ld", v); return b;
+  }
+  std::string s_;
+};
+
+inline String operator+(String a, const String& b) { a += b; return a; }
+inline String operator+(String a, const char* b) { a += b; return a; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(String a, char c) { a += c; return a; }
+inline String operator+(String a, int v) { a += v; return a; }
+inline String operator+(String a, unsigned int v) { a += v; return a; }
+inline String operator+(String a, long v) { a += v; return a; }
+inline String operator+(String a, unsigned long v) { a += v; return a; }
+
+// ---------------------------------------------------------------- Print
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* b, size_t n) { size_t k = 0; while (n--) k += write(*b++); return k; }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+
+  size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String((long)v, (unsigned char)base)); }
+  size_t print(unsigned int v, int base = DEC) { return print(String((unsigned long)v, (unsigned char)base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+  size_t print(double v, int digits = 2) { return print(String(v, (unsigned int)digits)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(const T& v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[512];
+    va_list ap; va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, std::min<size_t>((size_t)n, sizeof(buf) - 1));
+  }
+};
+
+// Serial: output goes to stdout (or nowhere with --quiet), input is fed by
+// the simulator's script runner.
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  void end() {}
+  int available() { return (int)rx_.size(); }
+  int read() { if (rx_.empty()) return -1; int c = (uint8_t)rx_.front(); rx_.pop_front(); return c; }
+  int peek() { return rx_.empty() ? -1 : (uint8_t)rx_.front(); }
+  void flush() { fflush(stdout); }
+  void setRxBufferSize(size_t) {}
+  operator bool() const { return true; }
+  using Print::write;
+  // With echo off, BENCH: result lines still get through
+  size_t write(uint8_t c) override {
+    if (echo) { fputc(c, stdout); return 1; }
+    line_ += (char)c;
+    if (c == '\n') {
+      if (line_.compare(0, 6, "BENCH:") == 0) fputs(line_.c_str(), stdout);
+      line_.clear();
+    }
+    return 1;
+  }
+
+  void feed(const std::string& s) { rx_.insert(rx_.end(), s.begin(), s.end()); }
+  bool echo = true;
+private:
+  std::deque<char> rx_;
+  std::string line_;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  [[noreturn]] void restart();
+  uint32_t getFreeHeap() { return 200000; }
+};
+extern EspClass ESP;
+
+// CPU clock: recorded only, simulated time does not scale with it
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+// ---------------------------------------------------------------- ESP-IDF / FreeRTOS
+typedef int esp_err_t;
+#define ESP_OK          0
+#define ESP_FAIL        -1
+#define ESP_ERR_NO_MEM  0x101
+#define ESP_ERR_TIMEOUT 0x107
+const char* esp_err_to_name(esp_err_t err);
+
+typedef int gpio_num_t;
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+#define portMAX_DELAY 0xffffffffUL
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+typedef struct SimSem*  SemaphoreHandle_t;
+typedef struct SimTask* TaskHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initial);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t* woken);
+void vSemaphoreDelete(SemaphoreHandle_t s);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t s);
+
+BaseType_t xTaskCreate(void (*fn)(void*), const char* name, uint32_t stack, void* arg,
+                       UBaseType_t prio, TaskHandle_t* out);
+void xTaskNotifyGive(TaskHandle_t t);
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait);
+void vTaskDelay(TickType_t ticks);
@@ -0,0 +1,49 @@
+#pragma once
+// Host ArduinoJson: documents accept writes and read back empty. Only the
+// Wi-Fi HTTP handlers use JSON, and they never run in the host build.
+#include "Arduino.h"
+
+class JsonVariant;
+class JsonArray;
+class JsonObject;
+
+class JsonVariant {
+public:
+  JsonVariant operator[](const char*) const { return JsonVariant(); }
+  JsonVariant operator[](const String&) const { return JsonVariant(); }
+  JsonVariant operator[](size_t) const { return JsonVariant(); }
+  template <typename T> JsonVariant& operator=(const T&) { return *this; }
+  template <typename T> bool is() const { return false; }
+  template <typename T> T as() const { return T(); }
+  template <typename T> operator T() const { return T(); }
+  String operator|(const char* def) const { return String(def); }
+  int operator|(int def) const { return def; }
+  bool isNull() const { return true; }
+};
+
+class JsonObject : public JsonVariant {};
+
+class JsonArray : public JsonVariant {
+public:
+  template <typename T> bool add(const T&) { return true; }
+  JsonObject createNestedObject() { return JsonObject(); }
+  size_t size() const { return 0; }
+};
+
+class DynamicJsonDocument : public JsonVariant {
+public:
+  explicit DynamicJsonDocument(size_t) {}
+  template <typename T> T to() { return T(); }
+  bool containsKey(const char*) const { return false; }
+  JsonArray createNestedArray(const char*) { return JsonArray(); }
+  JsonObject createNestedObject(const char*) { return JsonObject(); }
+  void clear() {}
+};
+typedef DynamicJsonDocument JsonDocument;
+
+struct DeserializationError {
+  explicit operator bool() const { return true; }
+  const char* c_str() const { return "not available in host build"; }
+};
+template <typename S> DeserializationError deserializeJson(DynamicJsonDocument&, const S&) { return {}; }
+template <typename S> size_t serializeJson(const DynamicJsonDocument&, S&) { return 0; }
@@ -0,0 +1,13 @@
+#pragma once
+// Host mDNS: nothing is advertised
+#include "Arduino.h"
+
+class MDNSResponder {
+public:
+  bool begin(const char*) { return true; }
+  void end() {}
+  template <typename... A> bool addService(A&&...) { return true; }
+  template <typename... A> bool addServiceTxt(A&&...) { return true; }
+  template <typename... A> void setInstanceName(A&&...) {}
+};
+inline MDNSResponder MDNS;
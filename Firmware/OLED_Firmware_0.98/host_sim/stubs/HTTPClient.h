@@ -0,0 +1,25 @@
+#pragma once
+// Host HTTP client: every request fails
+#include "WiFiClientSecure.h"
+
+#define HTTP_CODE_OK 200
+
+typedef enum {
+  HTTPC_DISABLE_FOLLOW_REDIRECTS,
+  HTTPC_STRICT_FOLLOW_REDIRECTS,
+  HTTPC_FORCE_FOLLOW_REDIRECTS
+} followRedirects_t;
+
+class HTTPClient {
+public:
+  template <typename... A> bool begin(A&&...) { return false; }
+  void end() {}
+  void addHeader(const String&, const String&) {}
+  void setTimeout(uint16_t) {}
+  void setFollowRedirects(followRedirects_t) {}
+  int GET() { return -1; }
+  int POST(const String&) { return -1; }
+  int getSize() { return -1; }
+  String getString() { return String(); }
+  WiFiClient* getStreamPtr() { return nullptr; }
+};
@@ -0,0 +1,24 @@
+#pragma once
+// Host OSC: messages can be built but never arrive or leave
+#include "Arduino.h"
+
+class OSCMessage {
+public:
+  OSCMessage() {}
+  explicit OSCMessage(const char*) {}
+  template <typename T> OSCMessage& add(T) { return *this; }
+  void fill(uint8_t) {}
+  bool hasError() const { return true; }
+  bool dispatch(const char*, void (*)(OSCMessage&), int = 0) { return false; }
+  bool fullMatch(const char*, int = 0) { return false; }
+  void empty() {}
+  int size() const { return 0; }
+  int32_t getInt(int) const { return 0; }
+  float getFloat(int) const { return 0; }
+  int getString(int, char* buf, int len) const { if (len > 0) buf[0] = 0; return 0; }
+  bool isInt(int) const { return false; }
+  bool isFloat(int) const { return false; }
+  bool isString(int) const { return false; }
+  int getAddress(char* buf, int = 0) const { buf[0] = 0; return 0; }
+  void send(Print&) {}
+};
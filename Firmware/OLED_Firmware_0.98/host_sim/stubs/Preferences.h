@@ -0,0 +1,50 @@
+#pragma once
+// Host NVS: namespaces live in memory for the length of a simulator run.
+#include "Arduino.h"
+#include <map>
+
+class Preferences {
+public:
+  bool begin(const char* ns, bool readOnly = false) { ns_ = &store()[ns]; ro_ = readOnly; return true; }
+  void end() { ns_ = nullptr; }
+  bool clear() { if (!ns_ || ro_) return false; ns_->clear(); return true; }
+  bool remove(const char* key) { return ns_ && !ro_ && ns_->erase(key) > 0; }
+  bool isKey(const char* key) { return ns_ && ns_->count(key); }
+
+  size_t putString(const char* key, const String& v) { return put(key, v.std()); }
+  size_t putString(const char* key, const char* v) { return put(key, v); }
+  String getString(const char* key, const String& def = String()) { auto* v = get(key); return v ? String(*v) : def; }
+
+  size_t putBool(const char* key, bool v) { return put(key, v ? "1" : "0"); }
+  bool   getBool(const char* key, bool def = false) { auto* v = get(key); return v ? *v == "1" : def; }
+  size_t putUChar(const char* key, uint8_t v) { return putNum(key, v); }
+  uint8_t getUChar(const char* key, uint8_t def = 0) { return (uint8_t)getNum(key, def); }
+  size_t putUShort(const char* key, uint16_t v) { return putNum(key, v); }
+  uint16_t getUShort(const char* key, uint16_t def = 0) { return (uint16_t)getNum(key, def); }
+  size_t putInt(const char* key, int32_t v) { return putNum(key, v); }
+  int32_t getInt(const char* key, int32_t def = 0) { return (int32_t)getNum(key, def); }
+  size_t putUInt(const char* key, uint32_t v) { return putNum(key, v); }
+  uint32_t getUInt(const char* key, uint32_t def = 0) { return (uint32_t)getNum(key, def); }
+  size_t putULong(const char* key, uint32_t v) { return putNum(key, v); }
+  uint32_t getULong(const char* key, uint32_t def = 0) { return (uint32_t)getNum(key, def); }
+  size_t putBytes(const char* key, const void* b, size_t n) { return put(key, std::string((const char*)b, n)); }
+  size_t getBytes(const char* key, void* b, size_t n) {
+    auto* v = get(key); if (!v) return 0;
+    size_t k = std::min(n, v->size()); memcpy(b, v->data(), k); return k;
+  }
+  size_t getBytesLength(const char* key) { auto* v = get(key); return v ? v->size() : 0; }
+
+  static std::map<std::string, std::map<std::string, std::string>>& store() {
+    static std::map<std::string, std::map<std::string, std::string>> s;
+    return s;
+  }
+
+private:
+  size_t put(const char* key, const std::string& v) { if (!ns_ || ro_) return 0; (*ns_)[key] = v; return v.size() ? v.size() : 1; }
+  const std::string* get(const char* key) { if (!ns_) return nullptr; auto it = ns_->find(key); return it == ns_->end() ? nullptr : &it->second; }
+  size_t putNum(const char* key, long long v) { return put(key, std::to_string(v)); }
+  long long getNum(const char* key, long long def) { auto* v = get(key); return v ? atoll(v->c_str()) : def; }
+
+  std::map<std::string, std::string>* ns_ = nullptr;
+  bool ro_ = false;
+};
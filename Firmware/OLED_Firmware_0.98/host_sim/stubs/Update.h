@@ -0,0 +1,23 @@
+#pragma once
+// Host OTA target: the image is counted, not flashed
+#include "Arduino.h"
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass {
+public:
+  bool begin(size_t) { size_ = 0; open_ = true; return true; }
+  size_t write(uint8_t*, size_t n) { if (!open_) return 0; size_ += n; return n; }
+  bool end(bool = false) {
+    if (!open_) return false;
+    open_ = false;
+    printf("SIM update image %zu bytes accepted\n", size_);
+    return true;
+  }
+  void abort() { open_ = false; }
+  const char* errorString() { return "no update in progress"; }
+private:
+  bool open_ = false;
+  size_t size_ = 0;
+};
+inline UpdateClass Update;
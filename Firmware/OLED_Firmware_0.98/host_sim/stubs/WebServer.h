@@ -0,0 +1,22 @@
+#pragma once
+// Host HTTP server: routes register, no client ever connects
+#include "WiFi.h"
+
+typedef enum { HTTP_ANY, HTTP_GET, HTTP_POST, HTTP_PUT, HTTP_DELETE, HTTP_OPTIONS } HTTPMethod;
+
+class WebServer {
+public:
+  explicit WebServer(int = 80) {}
+  template <typename... A> void on(A&&...) {}
+  template <typename F> void onNotFound(F) {}
+  void begin() {}
+  void stop() {}
+  void handleClient() {}
+  void send(int, const char* = nullptr, const String& = String()) {}
+  void send(int, const String&, const String&) {}
+  void sendHeader(const String&, const String&, bool = false) {}
+  String arg(const String&) const { return String(); }
+  bool hasArg(const String&) const { return false; }
+  String uri() const { return String(); }
+  HTTPMethod method() const { return HTTP_GET; }
+};
@@ -0,0 +1,65 @@
+#pragma once
+// Host WiFi: the radio never comes up, so the sketch stays on its wired
+// (serial) path. Everything here only has to compile and report "offline".
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4,
+               WL_CONNECTION_LOST = 5, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+#define WIFI_AUTH_OPEN 0
+
+class IPAddress {
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : o_{a, b, c, d} {}
+  IPAddress(uint32_t v) { memcpy(o_, &v, 4); }
+  operator uint32_t() const { uint32_t v; memcpy(&v, o_, 4); return v; }
+  uint8_t operator[](int i) const { return o_[i]; }
+  uint8_t& operator[](int i) { return o_[i]; }
+  bool operator==(const IPAddress& o) const { return !memcmp(o_, o.o_, 4); }
+  bool operator!=(const IPAddress& o) const { return !(*this == o); }
+  bool fromString(const String& s) {
+    unsigned a, b, c, d;
+    if (sscanf(s.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) return false;
+    o_[0] = a; o_[1] = b; o_[2] = c; o_[3] = d; return true;
+  }
+  String toString() const {
+    char b[16]; snprintf(b, sizeof(b), "%u.%u.%u.%u", o_[0], o_[1], o_[2], o_[3]); return String(b);
+  }
+private:
+  uint8_t o_[4] = {0, 0, 0, 0};
+};
+#define INADDR_NONE IPAddress(0, 0, 0, 0)
+
+class WiFiClass {
+public:
+  template <typename... A> wl_status_t begin(A&&...) { return WL_DISCONNECTED; }
+  template <typename... A> bool disconnect(A&&...) { return true; }
+  template <typename... A> bool config(A&&...) { return true; }
+  template <typename... A> bool softAP(A&&...) { return false; }
+  template <typename... A> bool softAPdisconnect(A&&...) { return true; }
+  bool mode(wifi_mode_t m) { mode_ = m; return true; }
+  wifi_mode_t getMode() const { return mode_; }
+  wl_status_t status() const { return WL_DISCONNECTED; }
+  IPAddress localIP() const { return IPAddress(); }
+  IPAddress gatewayIP() const { return IPAddress(); }
+  IPAddress subnetMask() const { return IPAddress(); }
+  IPAddress broadcastIP() const { return IPAddress(); }
+  IPAddress dnsIP(uint8_t = 0) const { return IPAddress(); }
+  IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+  uint8_t softAPgetStationNum() const { return 0; }
+  void persistent(bool) {}
+  bool setSleep(bool) { return true; }
+  bool setAutoReconnect(bool) { return true; }
+  bool setHostname(const char*) { return true; }
+  const char* getHostname() const { return "tds8"; }
+  String macAddress() const { return String("00:00:00:00:00:00"); }
+  template <typename... A> int16_t scanNetworks(A&&...) { return 0; }
+  void scanDelete() {}
+  String SSID(uint8_t = 0) const { return String(); }
+  int32_t RSSI(uint8_t = 0) const { return 0; }
+  uint8_t encryptionType(uint8_t) const { return WIFI_AUTH_OPEN; }
+private:
+  wifi_mode_t mode_ = WIFI_OFF;
+};
+inline WiFiClass WiFi;
@@ -0,0 +1,21 @@
+#pragma once
+// Host TLS client: never connects
+#include "WiFi.h"
+
+class WiFiClient : public Print {
+public:
+  template <typename... A> int connect(A&&...) { return 0; }
+  bool connected() { return false; }
+  int available() { return 0; }
+  int read() { return -1; }
+  int read(uint8_t*, size_t) { return -1; }
+  void stop() {}
+  using Print::write;
+  size_t write(uint8_t) override { return 0; }
+};
+
+class WiFiClientSecure : public WiFiClient {
+public:
+  void setInsecure() {}
+  void setCACert(const char*) {}
+};
@@ -0,0 +1,12 @@
+#pragma once
+// Host WiFiManager: the config portal always times out
+#include "Arduino.h"
+
+class WiFiManager {
+public:
+  void setConfigPortalBlocking(bool) {}
+  void setConfigPortalTimeout(unsigned long) {}
+  template <typename... A> bool startConfigPortal(A&&...) { return false; }
+  template <typename... A> bool autoConnect(A&&...) { return false; }
+  void resetSettings() {}
+};
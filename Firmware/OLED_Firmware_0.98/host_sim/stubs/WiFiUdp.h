@@ -0,0 +1,20 @@
+#pragma once
+// Host UDP: nothing ever arrives, writes are dropped
+#include "WiFi.h"
+
+class WiFiUDP : public Print {
+public:
+  uint8_t begin(uint16_t) { return 1; }
+  void stop() {}
+  int beginPacket(IPAddress, uint16_t) { return 1; }
+  int beginPacket(const char*, uint16_t) { return 1; }
+  int endPacket() { return 1; }
+  int parsePacket() { return 0; }
+  int available() { return 0; }
+  int read() { return -1; }
+  int read(uint8_t*, size_t) { return 0; }
+  IPAddress remoteIP() const { return IPAddress(); }
+  uint16_t remotePort() const { return 0; }
+  using Print::write;
+  size_t write(uint8_t) override { return 1; }
+};
@@ -0,0 +1,29 @@
+#pragma once
+// Host Wire: transactions go to the simulated bus (sim_bus.cpp), which
+// charges bus time at the configured clock and counts bytes.
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t freq = 0);
+  bool end();
+  bool setClock(uint32_t hz);
+  void setTimeOut(uint16_t ms) { timeoutMs_ = ms; }
+  void beginTransmission(uint8_t addr) { addr_ = addr; len_ = 0; }
+  size_t write(uint8_t b) { if (len_ >= I2C_BUFFER_LENGTH) return 0; buf_[len_++] = b; return 1; }
+  size_t write(const uint8_t* b, size_t n) { size_t k = 0; while (n-- && write(*b++)) k++; return k; }
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t addr, uint8_t n, bool sendStop = true);
+  int available() { return 0; }
+  int read() { return -1; }
+
+private:
+  uint8_t  addr_ = 0;
+  uint8_t  buf_[I2C_BUFFER_LENGTH];
+  size_t   len_ = 0;
+  uint32_t hz_ = 100000;
+  uint16_t timeoutMs_ = 50;
+};
+extern TwoWire Wire;
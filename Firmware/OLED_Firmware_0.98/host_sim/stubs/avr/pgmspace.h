@@ -0,0 +1,3 @@
+#pragma once
+// Lets the e-paper font tables (font8.c) build on the host
+#define PROGMEM
@@ -0,0 +1,43 @@
+#pragma once
+// Host ESP-IDF i2c_master driver: transmits are queued on the simulated bus
+// and complete in simulated time, firing on_trans_done like the real ISR.
+#include "Arduino.h"
+
+typedef int i2c_port_num_t;
+#define I2C_NUM_0 0
+typedef enum { I2C_CLK_SRC_DEFAULT = 0 } i2c_clock_source_t;
+typedef enum { I2C_ADDR_BIT_LEN_7 = 0 } i2c_addr_bit_len_t;
+
+typedef struct SimI2cBus* i2c_master_bus_handle_t;
+typedef struct SimI2cDev* i2c_master_dev_handle_t;
+
+typedef struct {
+  i2c_port_num_t     i2c_port;
+  gpio_num_t         sda_io_num;
+  gpio_num_t         scl_io_num;
+  i2c_clock_source_t clk_source;
+  uint8_t            glitch_ignore_cnt;
+  int                intr_priority;
+  size_t             trans_queue_depth;
+  struct { uint32_t enable_internal_pullup : 1; } flags;
+} i2c_master_bus_config_t;
+
+typedef struct {
+  i2c_addr_bit_len_t dev_addr_length;
+  uint16_t           device_address;
+  uint32_t           scl_speed_hz;
+  uint32_t           scl_wait_us;
+  struct { uint32_t disable_ack_check : 1; } flags;
+} i2c_device_config_t;
+
+typedef struct { int event; } i2c_master_event_data_t;
+typedef bool (*i2c_master_callback_t)(i2c_master_dev_handle_t, const i2c_master_event_data_t*, void*);
+typedef struct { i2c_master_callback_t on_trans_done; } i2c_master_event_callbacks_t;
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t* cfg, i2c_master_bus_handle_t* out);
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus);
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t* cfg,
+                                    i2c_master_dev_handle_t* out);
+esp_err_t i2c_master_register_event_callbacks(i2c_master_dev_handle_t dev,
+                                              const i2c_master_event_callbacks_t* cbs, void* arg);
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t* data, size_t len, int timeoutMs);
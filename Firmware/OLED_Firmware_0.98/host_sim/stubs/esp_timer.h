@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in: microseconds of simulated time (see sim_bus.h)
+#include <stdint.h>
+int64_t esp_timer_get_time();
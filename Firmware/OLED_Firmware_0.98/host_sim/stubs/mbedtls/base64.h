@@ -0,0 +1,31 @@
+#pragma once
+// Host base64 decode (RFC 4648, padding required)
+#include <stddef.h>
+#include <string.h>
+
+#define MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL  -0x002A
+#define MBEDTLS_ERR_BASE64_INVALID_CHARACTER -0x002C
+
+inline int mbedtls_base64_decode(unsigned char* dst, size_t dlen, size_t* olen,
+                                 const unsigned char* src, size_t slen) {
+  static const char* A = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  if (slen % 4) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+  size_t n = 0;
+  for (size_t i = 0; i < slen; i += 4) {
+    unsigned v = 0;
+    int pad = 0;
+    for (int k = 0; k < 4; k++) {
+      unsigned char ch = src[i + k];
+      const char* at = ch ? strchr(A, ch) : nullptr;
+      if (ch == '=' && i + 4 == slen && k >= 2) { pad++; v <<= 6; continue; }
+      if (!at || pad) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+      v = (v << 6) | (unsigned)(at - A);
+    }
+    for (int k = 0; k < 3 - pad; k++) {
+      if (n >= dlen) return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+      dst[n++] = (unsigned char)(v >> (16 - 8 * k));
+    }
+  }
+  *olen = n;
+  return 0;
+}
@@ -0,0 +1,43 @@
+#!/usr/bin/env node
+/**
+ * Package a firmware image for OTA.
+ * Writes <image>.gz next to the .bin (the firmware inflates it while
+ * flashing) and prints the manifest entry, whose sha256 is that of the
+ * uncompressed image - the firmware hashes what it writes, not what it
+ * downloads.
+ * Updates that arrive without a sha256 are refused, so pass the shipped
+ * manifest.json files after --write to stamp the entry into them.
+ * Usage: node pack_ota.js build/OLED_Firmware_0.98.ino.bin <version> <release-url-prefix> [--write manifest.json...]
+ */
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
+
+const args = process.argv.slice(2);
+const writeAt = args.indexOf('--write');
+const manifestPaths = writeAt < 0 ? [] : args.splice(writeAt).slice(1);
+const [binPath, version, urlPrefix] = args;
+if (!binPath || !version) {
+  console.error('Usage: node pack_ota.js <firmware.bin> <version> [release-url-prefix] [--write manifest.json...]');
+  process.exit(1);
+}
+
+const bin = fs.readFileSync(binPath);
+const gz = zlib.gzipSync(bin, { level: 9 });
+const gzPath = binPath + '.gz';
+fs.writeFileSync(gzPath, gz);
+
+const name = path.basename(gzPath);
+const manifest = {
+  version,
+  url: urlPrefix ? urlPrefix.replace(/\/?$/, '/') + name : name,
+  sha256: crypto.createHash('sha256').update(bin).digest('hex'),
+  size: bin.length,
+};
+console.error(`${name}: ${bin.length} -> ${gz.length} bytes (${(100 * gz.length / bin.length).toFixed(1)}%)`);
+console.log(JSON.stringify(manifest, null, 2));
+for (const p of manifestPaths) {
+  fs.writeFileSync(p, JSON.stringify(manifest, null, 2));
+  console.error(`wrote ${p}`);
+}
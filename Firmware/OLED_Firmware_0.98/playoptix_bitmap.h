@@ -0,0 +1,88 @@
+#pragma once
+#include <Arduino.h>
+#define PLAYOPTIX_BITMAP_W 128
+#define PLAYOPTIX_BITMAP_H 64
+const uint8_t PLAYOPTIX_BITMAP_DATA[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xff, 0x30, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x30, 0x00, 0x00, 0x03, 0x87, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x00, 0x07, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xb0, 0xf8, 0x60, 0x6e, 0x01, 0xc3, 0xe1, 0xf2, 0x60, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xb1, 0xfc, 0x60, 0x6c, 0x00, 0xcf, 0xf1, 0xf6, 0x70, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xb3, 0x86, 0x60, 0x4c, 0x00, 0xcc, 0x39, 0x86, 0x39, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x07, 0x33, 0x06, 0x60, 0x4c, 0x00, 0xdc, 0x19, 0x86, 0x1b, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xff, 0x36, 0x03, 0x60, 0x6c, 0x00, 0xd8, 0x0d, 0x86, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x7c, 0x36, 0x03, 0x60, 0x6c, 0x01, 0xd8, 0x0d, 0x86, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x33, 0x03, 0x60, 0xe6, 0x01, 0x98, 0x19, 0x86, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x33, 0x03, 0x70, 0xe7, 0x03, 0x98, 0x19, 0xc6, 0x39, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x33, 0xfb, 0x3f, 0xe3, 0xff, 0x1b, 0xf0, 0xff, 0xf1, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x30, 0xfb, 0x1f, 0xe1, 0xfc, 0x1b, 0xe0, 0x7f, 0xe0, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+// PLAYOPTIX_BITMAP_DATA in SSD1306 page order, PackBits (206 bytes): unpackBits() into display.getBuffer()
+const uint8_t PLAYOPTIX_BITMAP_RLE[] PROGMEM = {
+  0x81, 0x00, 0x81, 0x00, 0xec, 0x00, 0x00, 0x80, 0xf9, 0xc0, 0xff, 0x80, 0xff, 0x00, 0xff, 0xc0,
+  0xe6, 0x00, 0xff, 0x80, 0xfd, 0xc0, 0xff, 0x80, 0xf1, 0x00, 0x01, 0xc0, 0x80, 0xfd, 0x00, 0x02,
+  0x80, 0xc0, 0x80, 0xcc, 0x00, 0xff, 0xff, 0x01, 0x1d, 0x40, 0xfd, 0xc0, 0x0b, 0xe1, 0x61, 0x7f,
+  0x1e, 0x00, 0xff, 0xff, 0x00, 0xc0, 0xf0, 0x38, 0x1c, 0xfd, 0x0c, 0x05, 0x38, 0xf0, 0xc0, 0x00,
+  0xfc, 0xfc, 0xfb, 0x00, 0x07, 0xfc, 0xcc, 0x00, 0xfc, 0xfe, 0x07, 0x03, 0x01, 0xfd, 0x00, 0x08,
+  0x01, 0x03, 0x87, 0xfe, 0xfc, 0x00, 0xe0, 0xf8, 0x38, 0xfd, 0x0c, 0x06, 0x1c, 0x38, 0xf0, 0xc0,
+  0x00, 0xff, 0xff, 0xfe, 0x0c, 0x0d, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x0c, 0x1c, 0x38, 0xb0, 0xc0,
+  0xe0, 0x70, 0x3c, 0x0c, 0xd6, 0x00, 0xfe, 0x0f, 0xf7, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x07,
+  0xff, 0x0c, 0x09, 0x1c, 0x0c, 0x0c, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x07, 0x0e, 0xfe, 0x0c, 0x08,
+  0x8c, 0xcf, 0xff, 0x3f, 0x00, 0x00, 0x03, 0x07, 0x0e, 0xfb, 0x0c, 0x07, 0x06, 0x07, 0x03, 0x00,
+  0x00, 0xff, 0xff, 0x00, 0xfc, 0x0c, 0x06, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x0e, 0xfe, 0x0c,
+  0xff, 0x0f, 0xfe, 0x0c, 0x08, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x07, 0x0e, 0x0c, 0x08, 0xb9, 0x00,
+  0xfd, 0x03, 0xff, 0x01, 0xef, 0x00, 0xff, 0x03, 0x81, 0x00, 0x81, 0x00, 0xce, 0x00
+
+};
@@ -69,3 +69,25 @@ const uint8_t S_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// S_BITMAP_DATA in SSD1306 page order, PackBits (284 bytes): unpackBits() into display.getBuffer()
+const uint8_t S_BITMAP_RLE[] PROGMEM = {
+  0xd1, 0x00, 0xff, 0x80, 0x05, 0xc0, 0x40, 0x60, 0x60, 0x20, 0x30, 0xf9, 0xb0, 0x06, 0xa0, 0x20,
+  0x60, 0x60, 0x40, 0x40, 0xc0, 0xfe, 0x80, 0xa1, 0x00, 0x25, 0xe0, 0x70, 0x1c, 0xce, 0xe6, 0x33,
+  0x99, 0xcd, 0x64, 0x32, 0x92, 0xdb, 0x49, 0x6d, 0x2d, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0x25, 0x2d,
+  0x6d, 0x69, 0x4b, 0xdb, 0xd2, 0x96, 0xb6, 0x24, 0x6d, 0xc9, 0xdb, 0x93, 0x36, 0x64, 0x0c, 0x18,
+  0xa8, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x7e, 0xff, 0x00, 0x7e, 0xff, 0x81, 0x3c, 0xff, 0x83, 0x18,
+  0x7e, 0xc7, 0x83, 0x81, 0xfb, 0x01, 0xff, 0x03, 0x09, 0x02, 0x06, 0x06, 0x0d, 0x09, 0x1b, 0x03,
+  0x06, 0x00, 0x01, 0xa3, 0x00, 0x21, 0x07, 0x0e, 0x38, 0x73, 0x67, 0xdc, 0x99, 0x33, 0x66, 0x4c,
+  0xd9, 0x9b, 0xb6, 0x26, 0x6c, 0x6d, 0x49, 0xdb, 0xd2, 0x92, 0xb6, 0xa6, 0x2c, 0x6c, 0x48, 0xd8,
+  0xd8, 0x90, 0xb0, 0x20, 0x60, 0xc0, 0xc0, 0x80, 0x9d, 0x00, 0xff, 0x01, 0x1f, 0x03, 0x02, 0x06,
+  0x04, 0x0d, 0x0d, 0x0b, 0x1b, 0x12, 0x16, 0x36, 0x24, 0x2d, 0x6d, 0x49, 0xdb, 0x92, 0xb6, 0x66,
+  0xec, 0xc9, 0x1b, 0x33, 0xe6, 0x8c, 0x39, 0x73, 0xc6, 0x1c, 0x78, 0xe0, 0x80, 0xa7, 0x00, 0x0c,
+  0x80, 0x00, 0x40, 0xc0, 0x80, 0x20, 0x60, 0xc0, 0x98, 0x30, 0x60, 0x40, 0xc0, 0xfe, 0x80, 0xfc,
+  0x00, 0x10, 0x80, 0x81, 0xc3, 0x7f, 0x18, 0x81, 0xff, 0x3c, 0x00, 0xff, 0x7e, 0x00, 0xff, 0x7f,
+  0x00, 0xe7, 0xff, 0xaa, 0x00, 0x15, 0x02, 0x0e, 0x1c, 0x39, 0x37, 0x6e, 0xcc, 0x99, 0xb3, 0x26,
+  0x6c, 0x49, 0xdb, 0x93, 0xb6, 0xb6, 0x24, 0x2d, 0x6d, 0x6d, 0x69, 0x69, 0xfe, 0x6d, 0x0e, 0x24,
+  0xb6, 0xb6, 0x93, 0xd9, 0x4c, 0x66, 0x33, 0x99, 0xdc, 0xe7, 0x73, 0x38, 0x0e, 0x07, 0xa2, 0x00,
+  0xff, 0x01, 0xff, 0x03, 0xff, 0x06, 0x05, 0x04, 0x05, 0x0d, 0x0d, 0x09, 0x09, 0xfd, 0x0b, 0xff,
+  0x09, 0xfe, 0x0d, 0x05, 0x04, 0x06, 0x06, 0x03, 0x03, 0x01, 0xcc, 0x00
+
+};
@@ -69,3 +69,23 @@ const uint8_t SCRIBBLE_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// SCRIBBLE_BITMAP_DATA in SSD1306 page order, PackBits (249 bytes): unpackBits() into display.getBuffer()
+const uint8_t SCRIBBLE_BITMAP_RLE[] PROGMEM = {
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xfc, 0x00, 0x1d, 0x10, 0x98, 0xfe, 0x04, 0x00, 0x08, 0xf8,
+  0xe0, 0xc0, 0xe8, 0x00, 0x00, 0xc0, 0x60, 0xf0, 0x60, 0xe0, 0x80, 0x00, 0xc0, 0xe8, 0x00, 0x20,
+  0xe0, 0xf0, 0x30, 0x00, 0x80, 0xc0, 0x60, 0xfe, 0xe0, 0x04, 0x20, 0x00, 0xf8, 0x78, 0x18, 0xfc,
+  0x00, 0x27, 0xc0, 0xe0, 0xa0, 0x90, 0x18, 0x48, 0x4c, 0x44, 0x46, 0xc2, 0xc2, 0x84, 0xc0, 0x20,
+  0xe0, 0x60, 0x00, 0xc0, 0xe8, 0x00, 0x00, 0xfc, 0xe0, 0x60, 0xe0, 0x60, 0xf0, 0xfc, 0xe0, 0x20,
+  0xe0, 0x40, 0xe0, 0xf8, 0x38, 0x00, 0xc0, 0xe0, 0xe0, 0x60, 0xfd, 0x00, 0x1f, 0xc0, 0xe0, 0xa0,
+  0xb0, 0x90, 0x48, 0x48, 0x44, 0x44, 0xc2, 0xe2, 0xe6, 0xe0, 0x30, 0x10, 0x00, 0xe0, 0xe0, 0x60,
+  0x20, 0x60, 0xc0, 0x80, 0xe8, 0x00, 0x00, 0xf0, 0xe0, 0x20, 0x10, 0xe0, 0x40, 0xf8, 0x00, 0x0a,
+  0x20, 0x3f, 0x3f, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x03, 0x03, 0x02, 0xfe, 0x03, 0x03, 0x19, 0x1c,
+  0x1e, 0x0f, 0xfe, 0x03, 0x05, 0x02, 0x03, 0x03, 0x02, 0x00, 0x02, 0xfe, 0x03, 0x08, 0x01, 0x00,
+  0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0xfd, 0x00, 0x0f, 0x40, 0x60, 0x60, 0x30, 0x18, 0x0c,
+  0x04, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0xfe, 0x03, 0x15, 0x02, 0x03, 0x07,
+  0x03, 0x03, 0x01, 0x00, 0x03, 0x07, 0x03, 0x03, 0x01, 0x00, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02,
+  0x02, 0x03, 0x01, 0xfd, 0x00, 0x0d, 0x40, 0x60, 0x30, 0x18, 0x08, 0x04, 0x06, 0x03, 0x01, 0x00,
+  0x00, 0x03, 0x00, 0x02, 0xfe, 0x03, 0xfc, 0x00, 0x07, 0x03, 0x02, 0x07, 0x1f, 0x1f, 0x02, 0x01,
+  0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xfc, 0x00
+
+};
@@ -69,3 +69,17 @@ const uint8_t T_BITMAP_DATA[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
 };
+// T_BITMAP_DATA in SSD1306 page order, PackBits (152 bytes): unpackBits() into display.getBuffer()
+const uint8_t T_BITMAP_RLE[] PROGMEM = {
+  0xe3, 0x00, 0xd6, 0x60, 0xfe, 0xe0, 0xec, 0x60, 0xc4, 0x00, 0xde, 0xce, 0xfe, 0x0e, 0xff, 0xfe,
+  0xfe, 0x00, 0xfe, 0xff, 0xec, 0xce, 0xc4, 0x00, 0x00, 0x18, 0xea, 0x98, 0xfe, 0x18, 0xfe, 0xf8,
+  0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xec, 0xb8, 0xc4, 0x00,
+  0xeb, 0x03, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xec, 0x03, 0xae, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xff, 0x00,
+  0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0x99, 0x00, 0xff, 0xff, 0xfe, 0x00,
+  0xfe, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0x99, 0x00,
+  0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x00,
+  0xfe, 0xff, 0x99, 0x00, 0xff, 0x1f, 0xfe, 0x00, 0xfe, 0x1f, 0xff, 0x00, 0xfe, 0x1f, 0xfe, 0x00,
+  0xff, 0x1f, 0xfe, 0x00, 0xfe, 0x1f, 0xcd, 0x00
+
+};
@@ -0,0 +1,316 @@
+#pragma once
+// Generated by generate_glyphs.js from the e-paper Font8 table - do not edit
+#include <Arduino.h>
+#define UTF8_GLYPH_W 5
+#define UTF8_GLYPH_H 8
+#define UTF8_GLYPH_COUNT 307
+typedef struct { uint16_t cp; uint8_t rows[UTF8_GLYPH_H]; } Utf8Glyph;
+const Utf8Glyph UTF8_GLYPHS[] PROGMEM = {
+  { 0x0020, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, //  
+  { 0x0021, { 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00 } }, // !
+  { 0x0022, { 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // "
+  { 0x0023, { 0x28, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0xa0, 0x00 } }, // #
+  { 0x0024, { 0x20, 0x30, 0x60, 0x30, 0x10, 0x60, 0x20, 0x00 } }, // $
+  { 0x0025, { 0x20, 0x20, 0x18, 0x60, 0x10, 0x10, 0x00, 0x00 } }, // %
+  { 0x0026, { 0x00, 0x38, 0x20, 0x60, 0x50, 0x78, 0x00, 0x00 } }, // &
+  { 0x0027, { 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // '
+  { 0x0028, { 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00 } }, // (
+  { 0x0029, { 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x00 } }, // )
+  { 0x002A, { 0x20, 0x70, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00 } }, // *
+  { 0x002B, { 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00 } }, // +
+  { 0x002C, { 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x20, 0x00 } }, // ,
+  { 0x002D, { 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00 } }, // -
+  { 0x002E, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00 } }, // .
+  { 0x002F, { 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00 } }, // /
+  { 0x0030, { 0x20, 0x50, 0x50, 0x50, 0x50, 0x20, 0x00, 0x00 } }, // 0
+  { 0x0031, { 0x60, 0x20, 0x20, 0x20, 0x20, 0xf8, 0x00, 0x00 } }, // 1
+  { 0x0032, { 0x20, 0x50, 0x20, 0x20, 0x40, 0x70, 0x00, 0x00 } }, // 2
+  { 0x0033, { 0x20, 0x50, 0x10, 0x20, 0x10, 0x60, 0x00, 0x00 } }, // 3
+  { 0x0034, { 0x10, 0x30, 0x50, 0x78, 0x10, 0x38, 0x00, 0x00 } }, // 4
+  { 0x0035, { 0x70, 0x40, 0x60, 0x10, 0x50, 0x20, 0x00, 0x00 } }, // 5
+  { 0x0036, { 0x30, 0x40, 0x60, 0x50, 0x50, 0x60, 0x00, 0x00 } }, // 6
+  { 0x0037, { 0x70, 0x50, 0x10, 0x20, 0x20, 0x20, 0x00, 0x00 } }, // 7
+  { 0x0038, { 0x20, 0x50, 0x20, 0x50, 0x50, 0x20, 0x00, 0x00 } }, // 8
+  { 0x0039, { 0x30, 0x50, 0x50, 0x30, 0x10, 0x60, 0x00, 0x00 } }, // 9
+  { 0x003A, { 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00 } }, // :
+  { 0x003B, { 0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x00, 0x00 } }, // ;
+  { 0x003C, { 0x00, 0x10, 0x20, 0xc0, 0x20, 0x10, 0x00, 0x00 } }, // <
+  { 0x003D, { 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00 } }, // =
+  { 0x003E, { 0x00, 0x40, 0x20, 0x18, 0x20, 0x40, 0x00, 0x00 } }, // >
+  { 0x003F, { 0x20, 0x50, 0x10, 0x20, 0x00, 0x20, 0x00, 0x00 } }, // ?
+  { 0x0040, { 0x30, 0x48, 0x48, 0x58, 0x48, 0x40, 0x38, 0x00 } }, // @
+  { 0x0041, { 0x60, 0x20, 0x50, 0x70, 0x88, 0xd8, 0x00, 0x00 } }, // A
+  { 0x0042, { 0xf0, 0x48, 0x70, 0x48, 0x48, 0xf0, 0x00, 0x00 } }, // B
+  { 0x0043, { 0x70, 0x50, 0x40, 0x40, 0x40, 0x30, 0x00, 0x00 } }, // C
+  { 0x0044, { 0xf0, 0x48, 0x48, 0x48, 0x48, 0xf0, 0x00, 0x00 } }, // D
+  { 0x0045, { 0xf8, 0x48, 0x60, 0x40, 0x48, 0xf8, 0x00, 0x00 } }, // E
+  { 0x0046, { 0xf8, 0x48, 0x60, 0x40, 0x40, 0xe0, 0x00, 0x00 } }, // F
+  { 0x0047, { 0x70, 0x40, 0x40, 0x58, 0x50, 0x30, 0x00, 0x00 } }, // G
+  { 0x0048, { 0xe8, 0x48, 0x78, 0x48, 0x48, 0xe8, 0x00, 0x00 } }, // H
+  { 0x0049, { 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // I
+  { 0x004A, { 0x38, 0x10, 0x10, 0x50, 0x50, 0x20, 0x00, 0x00 } }, // J
+  { 0x004B, { 0xd8, 0x50, 0x60, 0x70, 0x50, 0xd8, 0x00, 0x00 } }, // K
+  { 0x004C, { 0xe0, 0x40, 0x40, 0x40, 0x48, 0xf8, 0x00, 0x00 } }, // L
+  { 0x004D, { 0xd8, 0xd8, 0xd8, 0xa8, 0x88, 0xd8, 0x00, 0x00 } }, // M
+  { 0x004E, { 0xd8, 0x68, 0x68, 0x58, 0x58, 0xe8, 0x00, 0x00 } }, // N
+  { 0x004F, { 0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // O
+  { 0x0050, { 0xf0, 0x48, 0x48, 0x70, 0x40, 0xe0, 0x00, 0x00 } }, // P
+  { 0x0051, { 0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x18, 0x00 } }, // Q
+  { 0x0052, { 0xf0, 0x48, 0x48, 0x70, 0x48, 0xe8, 0x00, 0x00 } }, // R
+  { 0x0053, { 0x70, 0x50, 0x20, 0x10, 0x50, 0x70, 0x00, 0x00 } }, // S
+  { 0x0054, { 0xf8, 0xa8, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // T
+  { 0x0055, { 0xd8, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // U
+  { 0x0056, { 0xd8, 0x88, 0x48, 0x50, 0x50, 0x30, 0x00, 0x00 } }, // V
+  { 0x0057, { 0xd8, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00 } }, // W
+  { 0x0058, { 0xd8, 0x50, 0x20, 0x20, 0x50, 0xd8, 0x00, 0x00 } }, // X
+  { 0x0059, { 0xd8, 0x88, 0x50, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Y
+  { 0x005A, { 0x78, 0x48, 0x10, 0x20, 0x48, 0x78, 0x00, 0x00 } }, // Z
+  { 0x005B, { 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x00 } }, // [
+  { 0x005C, { 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x00 } }, // backslash
+  { 0x005D, { 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x00 } }, // ]
+  { 0x005E, { 0x20, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // ^
+  { 0x005F, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8 } }, // _
+  { 0x0060, { 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // `
+  { 0x0061, { 0x00, 0x00, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // a
+  { 0x0062, { 0xc0, 0x40, 0x70, 0x48, 0x48, 0xf0, 0x00, 0x00 } }, // b
+  { 0x0063, { 0x00, 0x00, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00 } }, // c
+  { 0x0064, { 0x18, 0x08, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // d
+  { 0x0065, { 0x00, 0x00, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // e
+  { 0x0066, { 0x10, 0x20, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // f
+  { 0x0067, { 0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x08, 0x30 } }, // g
+  { 0x0068, { 0xc0, 0x40, 0x70, 0x48, 0x48, 0xe8, 0x00, 0x00 } }, // h
+  { 0x0069, { 0x20, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // i
+  { 0x006A, { 0x20, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x70 } }, // j
+  { 0x006B, { 0xc0, 0x40, 0x58, 0x70, 0x50, 0xd8, 0x00, 0x00 } }, // k
+  { 0x006C, { 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // l
+  { 0x006D, { 0x00, 0x00, 0xd0, 0xa8, 0xa8, 0xa8, 0x00, 0x00 } }, // m
+  { 0x006E, { 0x00, 0x00, 0xf0, 0x48, 0x48, 0xc8, 0x00, 0x00 } }, // n
+  { 0x006F, { 0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // o
+  { 0x0070, { 0x00, 0x00, 0xf0, 0x48, 0x48, 0x70, 0x40, 0xe0 } }, // p
+  { 0x0071, { 0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x08, 0x18 } }, // q
+  { 0x0072, { 0x00, 0x00, 0x78, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // r
+  { 0x0073, { 0x00, 0x00, 0x30, 0x20, 0x10, 0x60, 0x00, 0x00 } }, // s
+  { 0x0074, { 0x00, 0x40, 0xf0, 0x40, 0x48, 0x30, 0x00, 0x00 } }, // t
+  { 0x0075, { 0x00, 0x00, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // u
+  { 0x0076, { 0x00, 0x00, 0xc8, 0x48, 0x30, 0x30, 0x00, 0x00 } }, // v
+  { 0x0077, { 0x00, 0x00, 0xd8, 0xa8, 0xa8, 0x50, 0x00, 0x00 } }, // w
+  { 0x0078, { 0x00, 0x00, 0x48, 0x30, 0x30, 0x48, 0x00, 0x00 } }, // x
+  { 0x0079, { 0x00, 0x00, 0xd8, 0x50, 0x50, 0x20, 0x20, 0x60 } }, // y
+  { 0x007A, { 0x00, 0x00, 0x78, 0x50, 0x28, 0x78, 0x00, 0x00 } }, // z
+  { 0x007B, { 0x10, 0x20, 0x20, 0x60, 0x20, 0x20, 0x10, 0x00 } }, // {
+  { 0x007C, { 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00 } }, // |
+  { 0x007D, { 0x40, 0x20, 0x20, 0x30, 0x20, 0x20, 0x40, 0x00 } }, // }
+  { 0x007E, { 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00 } }, // ~
+  { 0x00A0, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, //  
+  { 0x00A1, { 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00 } }, // ¡
+  { 0x00A2, { 0x20, 0x70, 0x40, 0x40, 0x70, 0x20, 0x00, 0x00 } }, // ¢
+  { 0x00A3, { 0x30, 0x40, 0xe0, 0x40, 0x40, 0xf8, 0x00, 0x00 } }, // £
+  { 0x00A5, { 0x88, 0x50, 0xf8, 0x20, 0xf8, 0x20, 0x00, 0x00 } }, // ¥
+  { 0x00A7, { 0x70, 0x40, 0x70, 0x50, 0x70, 0x10, 0x70, 0x00 } }, // §
+  { 0x00A9, { 0x70, 0x88, 0xa8, 0xc8, 0xa8, 0x88, 0x70, 0x00 } }, // ©
+  { 0x00AB, { 0x00, 0x00, 0x28, 0x50, 0xa0, 0x50, 0x28, 0x00 } }, // «
+  { 0x00AE, { 0x70, 0x88, 0xe8, 0xd8, 0xd8, 0x88, 0x70, 0x00 } }, // ®
+  { 0x00B0, { 0x60, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // °
+  { 0x00B1, { 0x20, 0x20, 0xf8, 0x20, 0x20, 0xf8, 0x00, 0x00 } }, // ±
+  { 0x00B5, { 0x00, 0x00, 0x90, 0x90, 0x90, 0xe8, 0x80, 0x80 } }, // µ
+  { 0x00B7, { 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00 } }, // ·
+  { 0x00BB, { 0x00, 0x00, 0xa0, 0x50, 0x28, 0x50, 0xa0, 0x00 } }, // »
+  { 0x00BF, { 0x20, 0x00, 0x20, 0x40, 0x88, 0x70, 0x00, 0x00 } }, // ¿
+  { 0x00C0, { 0x40, 0x20, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // À
+  { 0x00C1, { 0x10, 0x20, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Á
+  { 0x00C2, { 0x20, 0x50, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Â
+  { 0x00C3, { 0x68, 0xb0, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Ã
+  { 0x00C4, { 0x50, 0x00, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Ä
+  { 0x00C5, { 0x70, 0x50, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Å
+  { 0x00C6, { 0x78, 0xa0, 0xb0, 0xe0, 0xa0, 0xb8, 0x00, 0x00 } }, // Æ
+  { 0x00C7, { 0x70, 0x50, 0x40, 0x40, 0x40, 0x30, 0x20, 0x60 } }, // Ç
+  { 0x00C8, { 0x40, 0x20, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // È
+  { 0x00C9, { 0x10, 0x20, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // É
+  { 0x00CA, { 0x20, 0x50, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ê
+  { 0x00CB, { 0x50, 0x00, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ë
+  { 0x00CC, { 0x40, 0x20, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Ì
+  { 0x00CD, { 0x10, 0x20, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Í
+  { 0x00CE, { 0x20, 0x50, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Î
+  { 0x00CF, { 0x50, 0x00, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Ï
+  { 0x00D0, { 0xe0, 0x50, 0x48, 0xe8, 0x50, 0xe0, 0x00, 0x00 } }, // Ð
+  { 0x00D1, { 0x68, 0xb0, 0xd8, 0x68, 0x58, 0xe8, 0x00, 0x00 } }, // Ñ
+  { 0x00D2, { 0x40, 0x20, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ò
+  { 0x00D3, { 0x10, 0x20, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ó
+  { 0x00D4, { 0x20, 0x50, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ô
+  { 0x00D5, { 0x68, 0xb0, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Õ
+  { 0x00D6, { 0x50, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ö
+  { 0x00D7, { 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00, 0x00 } }, // ×
+  { 0x00D8, { 0x38, 0x58, 0x50, 0x68, 0xc8, 0xe0, 0x00, 0x00 } }, // Ø
+  { 0x00D9, { 0x40, 0x20, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ù
+  { 0x00DA, { 0x10, 0x20, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ú
+  { 0x00DB, { 0x20, 0x50, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Û
+  { 0x00DC, { 0x50, 0x00, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ü
+  { 0x00DD, { 0x10, 0x20, 0xd8, 0x88, 0x50, 0x70, 0x00, 0x00 } }, // Ý
+  { 0x00DE, { 0xc0, 0x70, 0x48, 0x48, 0x70, 0xc0, 0x00, 0x00 } }, // Þ
+  { 0x00DF, { 0x60, 0x90, 0xa0, 0x90, 0x90, 0xb0, 0x00, 0x00 } }, // ß
+  { 0x00E0, { 0x40, 0x20, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // à
+  { 0x00E1, { 0x10, 0x20, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // á
+  { 0x00E2, { 0x20, 0x50, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // â
+  { 0x00E3, { 0x68, 0xb0, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // ã
+  { 0x00E4, { 0x50, 0x00, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // ä
+  { 0x00E5, { 0x70, 0x50, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // å
+  { 0x00E6, { 0x00, 0x00, 0xd0, 0x38, 0xf0, 0xd8, 0x00, 0x00 } }, // æ
+  { 0x00E7, { 0x00, 0x00, 0x70, 0x40, 0x40, 0x70, 0x20, 0x60 } }, // ç
+  { 0x00E8, { 0x40, 0x20, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // è
+  { 0x00E9, { 0x10, 0x20, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // é
+  { 0x00EA, { 0x20, 0x50, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ê
+  { 0x00EB, { 0x50, 0x00, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ë
+  { 0x00EC, { 0x40, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ì
+  { 0x00ED, { 0x10, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // í
+  { 0x00EE, { 0x20, 0x50, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // î
+  { 0x00EF, { 0x50, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ï
+  { 0x00F0, { 0x50, 0x20, 0x50, 0x10, 0x78, 0x70, 0x00, 0x00 } }, // ð
+  { 0x00F1, { 0x68, 0xb0, 0xf0, 0x48, 0x48, 0xc8, 0x00, 0x00 } }, // ñ
+  { 0x00F2, { 0x40, 0x20, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ò
+  { 0x00F3, { 0x10, 0x20, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ó
+  { 0x00F4, { 0x20, 0x50, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ô
+  { 0x00F5, { 0x68, 0xb0, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // õ
+  { 0x00F6, { 0x50, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ö
+  { 0x00F7, { 0x00, 0x20, 0x00, 0xf8, 0x00, 0x20, 0x00, 0x00 } }, // ÷
+  { 0x00F8, { 0x00, 0x00, 0x38, 0x58, 0x68, 0xe0, 0x00, 0x00 } }, // ø
+  { 0x00F9, { 0x40, 0x20, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ù
+  { 0x00FA, { 0x10, 0x20, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ú
+  { 0x00FB, { 0x20, 0x50, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // û
+  { 0x00FC, { 0x50, 0x00, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ü
+  { 0x00FD, { 0x10, 0x20, 0xd8, 0x50, 0x50, 0x20, 0x20, 0x60 } }, // ý
+  { 0x00FE, { 0xc0, 0x40, 0x70, 0x48, 0x48, 0x70, 0x40, 0xe0 } }, // þ
+  { 0x00FF, { 0x50, 0x00, 0xd8, 0x50, 0x50, 0x20, 0x20, 0x60 } }, // ÿ
+  { 0x0100, { 0x70, 0x00, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Ā
+  { 0x0101, { 0x70, 0x00, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // ā
+  { 0x0102, { 0x88, 0x70, 0x60, 0x50, 0x70, 0xd8, 0x00, 0x00 } }, // Ă
+  { 0x0103, { 0x88, 0x70, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00 } }, // ă
+  { 0x0104, { 0x60, 0x20, 0x50, 0x70, 0x88, 0xd8, 0x20, 0x18 } }, // Ą
+  { 0x0105, { 0x00, 0x00, 0x30, 0x10, 0x70, 0x78, 0x20, 0x18 } }, // ą
+  { 0x0106, { 0x10, 0x20, 0x70, 0x50, 0x40, 0x30, 0x00, 0x00 } }, // Ć
+  { 0x0107, { 0x10, 0x20, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00 } }, // ć
+  { 0x0108, { 0x20, 0x50, 0x70, 0x50, 0x40, 0x30, 0x00, 0x00 } }, // Ĉ
+  { 0x0109, { 0x20, 0x50, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00 } }, // ĉ
+  { 0x010A, { 0x20, 0x00, 0x70, 0x50, 0x40, 0x30, 0x00, 0x00 } }, // Ċ
+  { 0x010B, { 0x20, 0x00, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00 } }, // ċ
+  { 0x010C, { 0x50, 0x20, 0x70, 0x50, 0x40, 0x30, 0x00, 0x00 } }, // Č
+  { 0x010D, { 0x50, 0x20, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00 } }, // č
+  { 0x010E, { 0x50, 0x20, 0xf0, 0x48, 0x48, 0xf0, 0x00, 0x00 } }, // Ď
+  { 0x010F, { 0x50, 0x20, 0x18, 0x08, 0x38, 0x38, 0x00, 0x00 } }, // ď
+  { 0x0110, { 0xe0, 0x50, 0x48, 0xe8, 0x50, 0xe0, 0x00, 0x00 } }, // Đ
+  { 0x0111, { 0x10, 0x38, 0x70, 0x90, 0x90, 0x78, 0x00, 0x00 } }, // đ
+  { 0x0112, { 0x70, 0x00, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ē
+  { 0x0113, { 0x70, 0x00, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ē
+  { 0x0114, { 0x88, 0x70, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ĕ
+  { 0x0115, { 0x88, 0x70, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ĕ
+  { 0x0116, { 0x20, 0x00, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ė
+  { 0x0117, { 0x20, 0x00, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ė
+  { 0x0118, { 0xf8, 0x48, 0x60, 0x40, 0x48, 0xf8, 0x20, 0x18 } }, // Ę
+  { 0x0119, { 0x00, 0x00, 0x70, 0x70, 0x40, 0x30, 0x20, 0x18 } }, // ę
+  { 0x011A, { 0x50, 0x20, 0xf8, 0x60, 0x40, 0xf8, 0x00, 0x00 } }, // Ě
+  { 0x011B, { 0x50, 0x20, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00 } }, // ě
+  { 0x011C, { 0x20, 0x50, 0x70, 0x40, 0x58, 0x30, 0x00, 0x00 } }, // Ĝ
+  { 0x011D, { 0x20, 0x50, 0x38, 0x48, 0x48, 0x38, 0x08, 0x30 } }, // ĝ
+  { 0x011E, { 0x88, 0x70, 0x70, 0x40, 0x58, 0x30, 0x00, 0x00 } }, // Ğ
+  { 0x011F, { 0x88, 0x70, 0x38, 0x48, 0x48, 0x38, 0x08, 0x30 } }, // ğ
+  { 0x0120, { 0x20, 0x00, 0x70, 0x40, 0x58, 0x30, 0x00, 0x00 } }, // Ġ
+  { 0x0121, { 0x20, 0x00, 0x38, 0x48, 0x48, 0x38, 0x08, 0x30 } }, // ġ
+  { 0x0122, { 0x70, 0x40, 0x40, 0x58, 0x50, 0x30, 0x20, 0x60 } }, // Ģ
+  { 0x0124, { 0x20, 0x50, 0xe8, 0x48, 0x78, 0xe8, 0x00, 0x00 } }, // Ĥ
+  { 0x0125, { 0x20, 0x50, 0xc0, 0x40, 0x70, 0xe8, 0x00, 0x00 } }, // ĥ
+  { 0x0126, { 0xd8, 0xf8, 0x70, 0x50, 0x50, 0xd8, 0x00, 0x00 } }, // Ħ
+  { 0x0127, { 0xc0, 0xe0, 0x40, 0x70, 0x48, 0xc8, 0x00, 0x00 } }, // ħ
+  { 0x0128, { 0x68, 0xb0, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Ĩ
+  { 0x0129, { 0x68, 0xb0, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ĩ
+  { 0x012A, { 0x70, 0x00, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Ī
+  { 0x012B, { 0x70, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ī
+  { 0x012C, { 0x88, 0x70, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // Ĭ
+  { 0x012D, { 0x88, 0x70, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ĭ
+  { 0x012E, { 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x18 } }, // Į
+  { 0x012F, { 0x00, 0x00, 0x60, 0x20, 0x20, 0x70, 0x20, 0x18 } }, // į
+  { 0x0130, { 0x20, 0x00, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // İ
+  { 0x0131, { 0x00, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ı
+  { 0x0134, { 0x20, 0x50, 0x38, 0x10, 0x50, 0x20, 0x00, 0x00 } }, // Ĵ
+  { 0x0135, { 0x20, 0x50, 0x70, 0x10, 0x10, 0x10, 0x10, 0xe0 } }, // ĵ
+  { 0x0136, { 0xd8, 0x50, 0x60, 0x70, 0x50, 0xd8, 0x20, 0x60 } }, // Ķ
+  { 0x0137, { 0xc0, 0x40, 0x58, 0x70, 0x50, 0xd8, 0x20, 0x60 } }, // ķ
+  { 0x0139, { 0x10, 0x20, 0xe0, 0x40, 0x48, 0xf8, 0x00, 0x00 } }, // Ĺ
+  { 0x013A, { 0x10, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ĺ
+  { 0x013B, { 0xe0, 0x40, 0x40, 0x40, 0x48, 0xf8, 0x20, 0x60 } }, // Ļ
+  { 0x013C, { 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x60 } }, // ļ
+  { 0x013D, { 0x50, 0x20, 0xe0, 0x40, 0x48, 0xf8, 0x00, 0x00 } }, // Ľ
+  { 0x013E, { 0x50, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ľ
+  { 0x0141, { 0xe0, 0x40, 0x60, 0xc0, 0x48, 0xf8, 0x00, 0x00 } }, // Ł
+  { 0x0142, { 0x60, 0x20, 0x30, 0x60, 0x20, 0x70, 0x00, 0x00 } }, // ł
+  { 0x0143, { 0x10, 0x20, 0xd8, 0x68, 0x58, 0xe8, 0x00, 0x00 } }, // Ń
+  { 0x0144, { 0x10, 0x20, 0xf0, 0x48, 0x48, 0xc8, 0x00, 0x00 } }, // ń
+  { 0x0145, { 0xd8, 0x68, 0x68, 0x58, 0x58, 0xe8, 0x20, 0x60 } }, // Ņ
+  { 0x0146, { 0x00, 0x00, 0xf0, 0x48, 0x48, 0xc8, 0x20, 0x60 } }, // ņ
+  { 0x0147, { 0x50, 0x20, 0xd8, 0x68, 0x58, 0xe8, 0x00, 0x00 } }, // Ň
+  { 0x0148, { 0x50, 0x20, 0xf0, 0x48, 0x48, 0xc8, 0x00, 0x00 } }, // ň
+  { 0x014A, { 0xc8, 0x68, 0x58, 0x48, 0x48, 0xc8, 0x08, 0x10 } }, // Ŋ
+  { 0x014B, { 0x00, 0x00, 0xf0, 0x48, 0x48, 0xc8, 0x08, 0x10 } }, // ŋ
+  { 0x014C, { 0x70, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ō
+  { 0x014D, { 0x70, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ō
+  { 0x014E, { 0x88, 0x70, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ŏ
+  { 0x014F, { 0x88, 0x70, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ŏ
+  { 0x0150, { 0x28, 0x50, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ő
+  { 0x0151, { 0x28, 0x50, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // ő
+  { 0x0152, { 0x78, 0xa0, 0xb0, 0xa0, 0xa0, 0x78, 0x00, 0x00 } }, // Œ
+  { 0x0153, { 0x00, 0x00, 0x50, 0xb8, 0xa0, 0x58, 0x00, 0x00 } }, // œ
+  { 0x0154, { 0x10, 0x20, 0xf0, 0x48, 0x70, 0xe8, 0x00, 0x00 } }, // Ŕ
+  { 0x0155, { 0x10, 0x20, 0x78, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ŕ
+  { 0x0156, { 0xf0, 0x48, 0x48, 0x70, 0x48, 0xe8, 0x20, 0x60 } }, // Ŗ
+  { 0x0157, { 0x00, 0x00, 0x78, 0x20, 0x20, 0x70, 0x20, 0x60 } }, // ŗ
+  { 0x0158, { 0x50, 0x20, 0xf0, 0x48, 0x70, 0xe8, 0x00, 0x00 } }, // Ř
+  { 0x0159, { 0x50, 0x20, 0x78, 0x20, 0x20, 0x70, 0x00, 0x00 } }, // ř
+  { 0x015A, { 0x10, 0x20, 0x70, 0x20, 0x10, 0x70, 0x00, 0x00 } }, // Ś
+  { 0x015B, { 0x10, 0x20, 0x30, 0x20, 0x10, 0x60, 0x00, 0x00 } }, // ś
+  { 0x015C, { 0x20, 0x50, 0x70, 0x20, 0x10, 0x70, 0x00, 0x00 } }, // Ŝ
+  { 0x015D, { 0x20, 0x50, 0x30, 0x20, 0x10, 0x60, 0x00, 0x00 } }, // ŝ
+  { 0x015E, { 0x70, 0x50, 0x20, 0x10, 0x50, 0x70, 0x20, 0x60 } }, // Ş
+  { 0x015F, { 0x00, 0x00, 0x30, 0x20, 0x10, 0x60, 0x20, 0x60 } }, // ş
+  { 0x0160, { 0x50, 0x20, 0x70, 0x20, 0x10, 0x70, 0x00, 0x00 } }, // Š
+  { 0x0161, { 0x50, 0x20, 0x30, 0x20, 0x10, 0x60, 0x00, 0x00 } }, // š
+  { 0x0162, { 0xf8, 0xa8, 0x20, 0x20, 0x20, 0x70, 0x20, 0x60 } }, // Ţ
+  { 0x0163, { 0x00, 0x40, 0xf0, 0x40, 0x48, 0x30, 0x20, 0x60 } }, // ţ
+  { 0x0164, { 0x50, 0x20, 0xf8, 0xa8, 0x20, 0x70, 0x00, 0x00 } }, // Ť
+  { 0x0165, { 0x50, 0x20, 0x00, 0xf0, 0x40, 0x30, 0x00, 0x00 } }, // ť
+  { 0x0168, { 0x68, 0xb0, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ũ
+  { 0x0169, { 0x68, 0xb0, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ũ
+  { 0x016A, { 0x70, 0x00, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ū
+  { 0x016B, { 0x70, 0x00, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ū
+  { 0x016C, { 0x88, 0x70, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ŭ
+  { 0x016D, { 0x88, 0x70, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ŭ
+  { 0x016E, { 0x70, 0x50, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ů
+  { 0x016F, { 0x70, 0x50, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ů
+  { 0x0170, { 0x28, 0x50, 0xd8, 0x48, 0x48, 0x30, 0x00, 0x00 } }, // Ű
+  { 0x0171, { 0x28, 0x50, 0xd8, 0x48, 0x48, 0x38, 0x00, 0x00 } }, // ű
+  { 0x0172, { 0xd8, 0x48, 0x48, 0x48, 0x48, 0x30, 0x20, 0x18 } }, // Ų
+  { 0x0173, { 0x00, 0x00, 0xd8, 0x48, 0x48, 0x38, 0x20, 0x18 } }, // ų
+  { 0x0174, { 0x20, 0x50, 0xd8, 0x88, 0xa8, 0x50, 0x00, 0x00 } }, // Ŵ
+  { 0x0175, { 0x20, 0x50, 0xd8, 0xa8, 0xa8, 0x50, 0x00, 0x00 } }, // ŵ
+  { 0x0176, { 0x20, 0x50, 0xd8, 0x88, 0x50, 0x70, 0x00, 0x00 } }, // Ŷ
+  { 0x0177, { 0x20, 0x50, 0xd8, 0x50, 0x50, 0x20, 0x20, 0x60 } }, // ŷ
+  { 0x0178, { 0x50, 0x00, 0xd8, 0x88, 0x50, 0x70, 0x00, 0x00 } }, // Ÿ
+  { 0x0179, { 0x10, 0x20, 0x78, 0x10, 0x20, 0x78, 0x00, 0x00 } }, // Ź
+  { 0x017A, { 0x10, 0x20, 0x78, 0x50, 0x28, 0x78, 0x00, 0x00 } }, // ź
+  { 0x017B, { 0x20, 0x00, 0x78, 0x10, 0x20, 0x78, 0x00, 0x00 } }, // Ż
+  { 0x017C, { 0x20, 0x00, 0x78, 0x50, 0x28, 0x78, 0x00, 0x00 } }, // ż
+  { 0x017D, { 0x50, 0x20, 0x78, 0x10, 0x20, 0x78, 0x00, 0x00 } }, // Ž
+  { 0x017E, { 0x50, 0x20, 0x78, 0x50, 0x28, 0x78, 0x00, 0x00 } }, // ž
+  { 0x0237, { 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0xe0 } }, // ȷ
+  { 0x2013, { 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00 } }, // –
+  { 0x2014, { 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00 } }, // —
+  { 0x2018, { 0x20, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // ‘
+  { 0x2019, { 0x30, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // ’
+  { 0x201C, { 0x50, 0xa0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // “
+  { 0x201D, { 0x68, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // ”
+  { 0x2022, { 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00 } }, // •
+  { 0x2026, { 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00 } }, // …
+  { 0x20AC, { 0x38, 0x40, 0xf0, 0x40, 0xf0, 0x40, 0x38, 0x00 } }, // €
+  { 0x266A, { 0x20, 0x30, 0x28, 0x20, 0x60, 0xe0, 0x40, 0x00 } }, // ♪
+  { 0x266B, { 0x78, 0x48, 0x48, 0x48, 0xd8, 0xd8, 0x00, 0x00 } }, // ♫
+  { 0x266D, { 0x40, 0x40, 0x60, 0x50, 0x50, 0x60, 0x00, 0x00 } }, // ♭
+  { 0x266F, { 0x50, 0xf8, 0x50, 0x50, 0xf8, 0x50, 0x00, 0x00 } }, // ♯
+  { 0xFFFD, { 0xf8, 0x88, 0x88, 0x88, 0x88, 0xf8, 0x00, 0x00 } }, // �
+};
@@ -0,0 +1,462 @@
+#!/usr/bin/env python3
+"""TDS-8 Bridge load harness.
+
+Runs the bridge (index.js) against a fake Max for Live peer on UDP and N
+virtual TDS-8 units on pty pairs, replays session scripts and reports
+OSC-to-serial latency and throughput per device. Linux only, standard
+library only; see README.md.
+"""
+
+import argparse
+import json
+import os
+import pty
+import re
+import selectors
+import shlex
+import socket
+import struct
+import subprocess
+import sys
+import time
+import tty
+import urllib.request
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_BRIDGE = os.path.join(HERE, '..', 'resources', 'app', 'index.js')
+
+M4L_PORT = 8001          # the bridge sends to M4L here (fixed in index.js)
+TRACKS_PER_ID = 8        # one DEVICE_ID step = one 8-track block, as in the firmware
+SIM_VERSION = 'v0.98-sim'
+HI_EVERY_S = 1.0
+DRAIN_S = 3.0
+
+TRACKNAME_RE = re.compile(r'^/trackname (\d+) "((?:[^"\\]|\\.)*)"(?: (-?\d+))?$')
+TAG_RE = re.compile(r' ~(\d+)$')
+
+PROJECT_NAMES = ['Kick', 'Snare Top', 'Hats', 'Bass DI', 'Pad Wide Stereo', 'Lead Vox',
+                 'Room Mics L/R', 'FX Return Long Tail', 'Perc', 'Keys', 'Strings', 'Sub']
+
+
+# ---- OSC ----
+
+def osc_string(s):
+    b = s.encode('utf-8') + b'\0'
+    return b + b'\0' * (-len(b) % 4)
+
+
+def osc_message(address, args):
+    tags, data = ',', b''
+    for a in args:
+        if isinstance(a, int):
+            tags += 'i'
+            data += struct.pack('>i', a)
+        elif isinstance(a, float):
+            tags += 'f'
+            data += struct.pack('>f', a)
+        else:
+            tags += 's'
+            data += osc_string(str(a))
+    return osc_string(address) + osc_string(tags) + data
+
+
+def osc_bundle(messages):
+    out = b'#bundle\0' + struct.pack('>II', 0, 1)   # timetag: immediately
+    for m in messages:
+        out += struct.pack('>i', len(m)) + m
+    return out
+
+
+def osc_read_string(buf, at):
+    end = buf.index(b'\0', at)
+    return buf[at:end].decode('utf-8', 'replace'), (end + 4) & ~3
+
+
+def osc_parse(buf):
+    """Messages in a packet as (address, args); bundles are flattened."""
+    if buf.startswith(b'#bundle\0'):
+        out, at = [], 16
+        while at + 4 <= len(buf):
+            size = struct.unpack_from('>i', buf, at)[0]
+            out += osc_parse(buf[at + 4:at + 4 + size])
+            at += 4 + size
+        return out
+    address, at = osc_read_string(buf, 0)
+    tags, at = osc_read_string(buf, at) if at < len(buf) else (',', at)
+    args = []
+    for t in tags[1:]:
+        if t == 'i':
+            args.append(struct.unpack_from('>i', buf, at)[0])
+            at += 4
+        elif t == 'f':
+            args.append(struct.unpack_from('>f', buf, at)[0])
+            at += 4
+        elif t == 's':
+            s, at = osc_read_string(buf, at)
+            args.append(s)
+    return [(address, args)]
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    v = sorted(values)
+    return v[min(len(v) - 1, int(len(v) * p / 100))]
+
+
+# ---- Virtual TDS-8 ----
+
+class VirtualDevice:
+    """One pty pair answering the firmware's serial text protocol."""
+
+    def __init__(self, index, screens):
+        self.index = index
+        self.screens = screens
+        self.master, self.slave = pty.openpty()
+        tty.setraw(self.slave)
+        os.set_blocking(self.master, False)
+        self.path = os.ttyname(self.slave)
+        self.buf = b''
+        self.device_id = None
+        self.names = [''] * screens
+        self.active = -1
+        self.lines = []          # (t, line) received since the session started
+
+    def feed(self, now, data):
+        self.buf += data
+        while b'\n' in self.buf:
+            raw, self.buf = self.buf.split(b'\n', 1)
+            line = raw.decode('utf-8', 'replace').strip()
+            if line:
+                self.lines.append((now, line))
+                self.reply(self.handle(line))
+
+    def handle(self, line):
+        if line == 'VERSION':
+            return 'VERSION: %s\nSCREENS: %d' % (SIM_VERSION, self.screens)
+        if line.startswith('DEVICE_ID'):
+            parts = line.split()
+            if len(parts) == 1:
+                return 'DEVICE_ID: %d' % (self.device_id or 0)
+            self.device_id = int(parts[1])
+            first = self.device_id * TRACKS_PER_ID
+            return 'OK: DEVICE_ID set to %d (tracks %d-%d)' % (self.device_id, first + 1, first + self.screens)
+        m = TRACKNAME_RE.match(line)
+        if m:
+            idx = int(m.group(1))
+            if idx >= self.screens:
+                return 'ERR: Index out of range (0-%d)' % (self.screens - 1)
+            self.names[idx] = m.group(2)
+            return 'OK: /trackname %d "%s" (track %s)' % (idx, m.group(2), m.group(3) or idx)
+        if line.startswith('/activetrack'):
+            self.active = int(line.split()[1])
+            return 'OK: /activetrack -1 (clear)' if self.active < 0 else 'OK: /activetrack %d' % self.active
+        if line == '/ping':
+            return 'OK: pong'
+        return 'ERR: Unknown command'
+
+    def reply(self, text):
+        try:
+            os.write(self.master, (text + '\n').encode('utf-8'))
+        except (BlockingIOError, OSError):
+            pass   # nobody reading; the real firmware drops output the same way
+
+    def close(self):
+        for fd in (self.master, self.slave):
+            try:
+                os.close(fd)
+            except OSError:
+                pass
+
+
+# ---- Harness ----
+
+class Harness:
+    def __init__(self, args):
+        self.args = args
+        self.sel = selectors.DefaultSelector()
+        self.devices = [VirtualDevice(i, args.screens) for i in range(args.devices)]
+        self.span = args.screens // TRACKS_PER_ID   # DEVICE_ID steps per unit
+        for d in self.devices:
+            self.sel.register(d.master, selectors.EVENT_READ, d)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(('127.0.0.1', M4L_PORT))
+        self.sock.setblocking(False)
+        self.sel.register(self.sock, selectors.EVENT_READ, None)
+        self.track_count = args.tracks
+        self.model = ['Track %d' % (i + 1) for i in range(self.track_count)]
+        self.project = 0
+        self.seq = 0
+        self.pending = {}        # seq -> (t_sent, device index)
+        self.foreign = set()     # seqs of tracks no unit shows
+        self.pending_active = [[] for _ in self.devices]   # FIFO of (t_sent, line)
+        self.latency = [[] for _ in self.devices]
+        self.misrouted = 0
+        self.stale = [0] * args.devices
+        self.sent = [0] * args.devices
+        self.snapshots = 0
+        self.next_hi = 0.0
+        self.bridge = None
+
+    # -- plumbing --
+
+    def send_osc(self, packet):
+        self.sock.sendto(packet, ('127.0.0.1', self.args.osc_port))
+
+    def pump(self, until):
+        while True:
+            now = time.monotonic()
+            if now >= self.next_hi:
+                self.send_osc(osc_message('/hi', []))
+                self.next_hi = now + HI_EVERY_S
+            timeout = max(0.0, min(until, self.next_hi) - now)
+            for key, _ in self.sel.select(timeout):
+                if key.data is None:
+                    self.on_osc(time.monotonic())
+                else:
+                    try:
+                        data = os.read(key.fd, 65536)
+                    except (BlockingIOError, OSError):
+                        continue
+                    self.on_serial(key.data, time.monotonic(), data)
+            if time.monotonic() >= until:
+                return
+
+    def wait_for(self, cond, timeout_s):
+        end = time.monotonic() + timeout_s
+        while not cond():
+            if time.monotonic() >= end:
+                return False
+            self.pump(min(end, time.monotonic() + 0.05))
+        return True
+
+    def first_track(self, dev):
+        return dev.index * self.span * TRACKS_PER_ID
+
+    def expected_device(self, track):
+        """Index of the unit showing `track`, or None when no unit does."""
+        i = track // (self.span * TRACKS_PER_ID)
+        return i if i < len(self.devices) else None
+
+    def check_names(self, name):
+        """Every panel must end up showing the model's name for its track
+        (blank past the end of the set); anything else is stale or foreign."""
+        for d in self.devices:
+            first = self.first_track(d)
+            for p, got in enumerate(d.names):
+                track = first + p
+                want = self.model[track] if track < self.track_count else ''
+                got = TAG_RE.sub('', got).replace('\\"', '"')
+                if got != want:
+                    self.stale[d.index] += 1
+                    if self.stale[d.index] <= 3:
+                        print('%s: SIM mismatch device=%d panel=%d track=%d want=%r got=%r'
+                              % (name, d.index, p, track + 1, want, got))
+
+    # -- fake M4L --
+
+    def tag(self, track, name):
+        self.seq += 1
+        dev = self.expected_device(track)
+        if dev is None:
+            self.foreign.add(self.seq)    # must not reach any unit
+        else:
+            self.pending[self.seq] = (time.monotonic(), dev)
+            self.sent[dev] += 1
+        return '%s ~%d' % (name, self.seq)
+
+    def on_osc(self, now):
+        try:
+            packet, _ = self.sock.recvfrom(65536)
+        except BlockingIOError:
+            return
+        for address, args in osc_parse(packet):
+            if address == '/request-tracknames':
+                start = int(args[0]) if args else 0
+                count = int(args[1]) if len(args) > 1 else self.track_count
+                self.send_snapshot(start, count)
+            elif address == '/request-trackname' and args:
+                i = int(args[0])
+                if 0 <= i < self.track_count:
+                    self.send_osc(osc_message('/trackname', [i, self.tag(i, self.model[i]), i + 1]))
+
+    def send_snapshot(self, start, count):
+        end = min(self.track_count, start + count)
+        msgs = [osc_message('/tracknames', [start, count])]
+        for i in range(start, end):
+            msgs.append(osc_message('/trackname', [i, self.tag(i, self.model[i]), i + 1]))
+        self.snapshots += 1
+        self.send_osc(osc_bundle(msgs))
+
+    def on_serial(self, dev, now, data):
+        first = len(dev.lines)
+        dev.feed(now, data)
+        for t, line in dev.lines[first:]:
+            m = TRACKNAME_RE.match(line)
+            if m:
+                tag = TAG_RE.search(m.group(2))
+                seq = int(tag.group(1)) if tag else None
+                if seq in self.pending:
+                    t_sent, want = self.pending.pop(seq)
+                    if want != dev.index:
+                        self.misrouted += 1
+                    self.latency[dev.index].append((t - t_sent) * 1000.0)
+                elif seq in self.foreign:
+                    self.misrouted += 1
+                continue
+            q = self.pending_active[dev.index]
+            for n, (t_sent, want) in enumerate(q):
+                if want == line:
+                    self.latency[dev.index].append((t - t_sent) * 1000.0)
+                    del q[n]
+                    break
+
+    # -- session steps --
+
+    def step(self, line):
+        if line.startswith('@wait'):
+            self.pump(time.monotonic() + float(line.split()[1]) / 1000.0)
+        elif line == '@load':
+            # A new project: every name changes, M4L says so and the bridge asks for a snapshot
+            self.project += 1
+            self.model = ['%s %d.%d' % (PROJECT_NAMES[i % len(PROJECT_NAMES)], self.project, i + 1)
+                          for i in range(self.track_count)]
+            self.send_osc(osc_message('/tracks-changed', []))
+        elif line.startswith('/'):
+            parts = shlex.split(line)
+            address = parts[0]
+            args = [int(p) if re.fullmatch(r'-?\d+', p) else p for p in parts[1:]]
+            if address == '/trackname' and len(args) >= 2:
+                track = args[2] - 1 if len(args) >= 3 else args[0]
+                if 0 <= track < self.track_count:
+                    self.model[track] = args[1]
+                    args[1] = self.tag(track, args[1])
+            elif address == '/activetrack' and args and 0 <= args[0] < self.track_count:
+                dev = self.expected_device(args[0])
+                if dev is not None:
+                    local = args[0] - self.first_track(self.devices[dev])
+                    self.pending_active[dev].append((time.monotonic(), '/activetrack %d' % local))
+                    self.sent[dev] += 1
+            self.send_osc(osc_message(address, args))
+        self.pump(time.monotonic())
+
+    def run_session(self, path):
+        with open(path) as f:
+            steps = [l.strip() for l in f if l.strip() and not l.lstrip().startswith('#')]
+        self.pending.clear()
+        for q in self.pending_active:
+            q.clear()
+        self.latency = [[] for _ in self.devices]
+        self.sent = [0] * len(self.devices)
+        self.stale = [0] * len(self.devices)
+        self.misrouted = 0
+        for d in self.devices:
+            d.lines = []
+        t0 = time.monotonic()
+        for s in steps:
+            self.step(s)
+        self.wait_for(lambda: not self.pending and not any(self.pending_active), DRAIN_S)
+        name = os.path.splitext(os.path.basename(path))[0]
+        self.pump(time.monotonic() + 0.2)   # stray writes that nothing waits for
+        self.check_names(name)
+        return self.report(name, t0)
+
+    def report(self, name, t0):
+        ops = got = 0
+        every = []
+        for d in self.devices:
+            lat = self.latency[d.index]
+            ops += self.sent[d.index]
+            got += len(lat)
+            every += lat
+            span = (d.lines[-1][0] - t0) if d.lines else 0.0
+            nbytes = sum(len(l) + 1 for _, l in d.lines)
+            print('%s: SIM device=%d ops=%d recv=%d lost=%d stale=%d p50_ms=%.2f p99_ms=%.2f max_ms=%.2f '
+                  'lines_per_s=%.0f bytes_per_s=%.0f'
+                  % (name, d.index, self.sent[d.index], len(lat), self.sent[d.index] - len(lat), self.stale[d.index],
+                     percentile(lat, 50), percentile(lat, 99), max(lat, default=0.0),
+                     len(d.lines) / span if span else 0.0, nbytes / span if span else 0.0))
+        stale = sum(self.stale)
+        print('%s: SIM summary devices=%d ops=%d recv=%d lost=%d misrouted=%d stale=%d p50_ms=%.2f p99_ms=%.2f '
+              'max_ms=%.2f secs=%.2f'
+              % (name, len(self.devices), ops, got, ops - got, self.misrouted, stale, percentile(every, 50),
+                 percentile(every, 99), max(every, default=0.0), time.monotonic() - t0))
+        sys.stdout.flush()
+        return ops == got and not self.misrouted and not stale
+
+    # -- bridge --
+
+    def start_bridge(self):
+        env = dict(os.environ, PORT=str(self.args.http_port), OSC_LISTEN_PORT=str(self.args.osc_port))
+        cmd = shlex.split(self.args.bridge_cmd) if self.args.bridge_cmd else [self.args.node, self.args.bridge]
+        self.bridge = subprocess.Popen(cmd, env=env, stdout=self.args.log, stderr=subprocess.STDOUT,
+                                       stdin=subprocess.DEVNULL)
+
+    def http(self, method, route, body=None):
+        req = urllib.request.Request('http://127.0.0.1:%d%s' % (self.args.http_port, route), method=method,
+                                     data=json.dumps(body).encode() if body is not None else None,
+                                     headers={'Content-Type': 'application/json'})
+        with urllib.request.urlopen(req, timeout=15) as r:
+            return json.loads(r.read() or b'{}')
+
+    def connect_devices(self):
+        def up():
+            try:
+                self.http('GET', '/api/osc-status')
+                return True
+            except OSError:
+                return False
+        if not self.wait_for(up, 20):
+            raise SystemExit('bridge did not come up on port %d' % self.args.http_port)
+        for d in self.devices:
+            self.http('POST', '/api/connect', {'path': d.path, 'deviceId': d.index * self.span})
+        # The bridge gives each unit 3 s to boot before DEVICE_ID
+        if not self.wait_for(lambda: all(x.device_id is not None for x in self.devices), 15):
+            raise SystemExit('devices never got DEVICE_ID')
+        # Let the first handshake, VERSION/SCREENS and snapshot settle
+        self.wait_for(lambda: self.snapshots > 0, 5)
+        self.pump(time.monotonic() + 1.0)
+
+    def close(self):
+        if self.bridge:
+            self.bridge.terminate()
+            try:
+                self.bridge.wait(5)
+            except subprocess.TimeoutExpired:
+                self.bridge.kill()
+        for d in self.devices:
+            d.close()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('sessions', nargs='+', help='session scripts (see sessions/)')
+    ap.add_argument('--devices', type=int, default=4, help='virtual TDS-8 units (default 4)')
+    ap.add_argument('--screens', type=int, default=8, choices=(8, 16, 24, 32),
+                    help='panels per unit, 8 per mux (default 8)')
+    ap.add_argument('--tracks', type=int, default=128, help='tracks in the fake Live set (default 128)')
+    ap.add_argument('--bridge', default=DEFAULT_BRIDGE, help='bridge entry point (default resources/app/index.js)')
+    ap.add_argument('--node', default='node', help='node binary')
+    ap.add_argument('--bridge-cmd', help='full command to start the bridge instead of node <bridge>')
+    ap.add_argument('--no-spawn', action='store_true', help='use a bridge that is already running')
+    ap.add_argument('--http-port', type=int, default=18088, help='bridge HTTP port (default 18088)')
+    ap.add_argument('--osc-port', type=int, default=8003, help='bridge OSC listen port (default 8003)')
+    ap.add_argument('--log', default='bridge_sim.log', help='bridge output (default bridge_sim.log)')
+    args = ap.parse_args()
+
+    args.log = open(args.log, 'w')
+    h = Harness(args)
+    try:
+        if not args.no_spawn:
+            h.start_bridge()
+        h.connect_devices()
+        ok = True
+        for s in args.sessions:
+            ok = h.run_session(s) and ok
+    finally:
+        h.close()
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -12,7 +12,8 @@ const { exec, spawn } = require('child_process');
 const { SerialPortStream } = require('@serialport/stream');
 const { autoDetect } = require('@serialport/bindings-cpp');
 const axios = require('axios');
-const tmp = require('tmp');
+const zlib = require('zlib');
+const crypto = require('crypto');
 
 const PORT = process.env.PORT || 8088;
 const OSC_LISTEN_PORT = parseInt(process.env.OSC_LISTEN_PORT || '8003', 10);  // M4L → Bridge default listener port (8003)
@@ -24,37 +25,117 @@ const FW_FEED_URL = process.env.FW_FEED_URL || '';
 
 const Bindings = autoDetect();
 
-// Multi-device support: Store up to 4 TDS-8 devices
-const MAX_DEVICES = 4;
+// ---- Logging ----
+// Leveled logger over a bounded ring (GET /api/logs). stdout gets lines at or
+// below LOG_LEVEL (error|warn|info|debug, default info). UI clients pick a
+// level with { type: 'log-level', level } over the socket and receive uiLog()
+// lines at or below it, plus debug lines once they ask for debug. Hot paths
+// test log.debugOn before building a debug string, so with nobody listening
+// a routed message costs no formatting or I/O at all.
+const LOG_LEVELS = { error: 0, warn: 1, info: 2, debug: 3 };
+const LOG_LEVEL = LOG_LEVELS[String(process.env.LOG_LEVEL || '').toLowerCase()] ?? LOG_LEVELS.info;
+const LOG_RING_SIZE = 2000;
+
+const log = (() => {
+  const ring = new Array(LOG_RING_SIZE);
+  let head = 0, count = 0;
+  const out = { error: console.error, warn: console.warn, info: console.log, debug: console.log };
+  const self = {
+    clients: null,          // wss.clients once the server exists
+    debugOn: LOG_LEVEL >= LOG_LEVELS.debug,
+    emit(level, msg, toUi) {
+      const lv = LOG_LEVELS[level];
+      ring[head] = { ts: Date.now(), level, msg };
+      head = (head + 1) % LOG_RING_SIZE;
+      if (count < LOG_RING_SIZE) count++;
+      if (lv <= LOG_LEVEL) out[level](msg);
+      if (!self.clients || !(toUi || lv === LOG_LEVELS.debug)) return;
+      let frame = null;
+      for (const c of self.clients) {
+        if (c.readyState !== 1 || (c.logLevel ?? LOG_LEVELS.info) < lv) continue;
+        frame = frame || JSON.stringify({ type: 'serial-data', data: msg, level });
+        wsEnqueue(c, 'log', frame);
+      }
+    },
+    error: (msg) => self.emit('error', msg, false),
+    warn:  (msg) => self.emit('warn', msg, false),
+    info:  (msg) => self.emit('info', msg, false),
+    debug: (msg) => { if (self.debugOn) self.emit('debug', msg, false); },
+    // A client changed level or went away: debug is on while anyone wants it
+    refresh() {
+      let any = LOG_LEVEL >= LOG_LEVELS.debug;
+      if (self.clients) for (const c of self.clients) if (c.logLevel >= LOG_LEVELS.debug) any = true;
+      self.debugOn = any;
+    },
+    // Newest last; level filters out anything more verbose
+    tail(limit = 200, level = 'debug') {
+      const max = LOG_LEVELS[level] ?? LOG_LEVELS.debug;
+      const res = [];
+      for (let i = 0; i < count && res.length < limit; i++) {
+        const e = ring[(head - 1 - i + LOG_RING_SIZE) % LOG_RING_SIZE];
+        if (LOG_LEVELS[e.level] <= max) res.push(e);
+      }
+      return res.reverse();
+    },
+  };
+  return self;
+})();
+
+// Multi-device support: up to 16 TDS-8 devices, 8 tracks each
+const MAX_DEVICES = 16;
 let devices = []; // Array of { id, serial, path, buffer, version, deviceID }
 // Track connection attempts and recent closes to avoid reset loops on ESP auto-boot
 const connectingPorts = new Set(); // ports currently being opened
 const portToDeviceId = new Map();  // sticky mapping of port -> deviceId
 const recentlyClosed = new Map();  // port -> timestamp of last close
 const RECONNECT_COOLDOWN_MS = 15000; // 15 second cooldown to prevent boot loop reconnects // wait before re-opening after a close
-// Allow remapping of 8-track display blocks (0..3) to any connected device(s).
+// Allow remapping of 8-track display blocks (0..MAX_DEVICES-1) to any connected device(s).
 // Keyed by serial path so it survives reconnects on the same COM port.
-const pathToDisplayBlock = new Map(); // path -> block index (0..3)
+const pathToDisplayBlock = new Map(); // path -> block index
+
+// Dedup tables are fixed arrays indexed by track slot, sized once for
+// DEDUP_SLOTS (MAX_DEVICES × 8 tracks) and SCREEN_SLOTS (MAX_DEVICES ×
+// DEVICE_SCREENS_MAX panels), so they cost the same after a week of renames
+// as after a minute. Indices outside the table are never suppressed.
+const DEDUP_SLOTS = MAX_DEVICES * 8;
+const DEVICE_SCREENS_MAX = 32;   // 4 muxes × 8 panels
+const SCREEN_SLOTS = MAX_DEVICES * DEVICE_SCREENS_MAX;
 
-// Global-level dedup keyed by actual track number (0..31)
-const lastGlobalTrack = new Map(); // key: globalIndex → { name, ts }
+// Global-level dedup keyed by actual track number
 const GLOBAL_TRACK_DEDUP_MS = 4000;
+const lastGlobalName = new Array(DEDUP_SLOTS).fill(null);
+const lastGlobalTs = new Float64Array(DEDUP_SLOTS);
+function noteGlobalTrack(globalIndex, nameEscaped, now) {
+  if (!(globalIndex >= 0 && globalIndex < DEDUP_SLOTS)) return;
+  lastGlobalName[globalIndex] = nameEscaped;
+  lastGlobalTs[globalIndex] = now;
+}
 function shouldForwardGlobal(globalIndex, nameEscaped) {
-  try {
-    const rec = lastGlobalTrack.get(globalIndex);
-    const now = Date.now();
-    if (rec && rec.name === nameEscaped && (now - rec.ts) < GLOBAL_TRACK_DEDUP_MS) {
-      return false;
-    }
-    lastGlobalTrack.set(globalIndex, { name: nameEscaped, ts: now });
-    return true;
-  } catch { return true; }
+  const now = Date.now();
+  if (globalIndex >= 0 && globalIndex < DEDUP_SLOTS &&
+      lastGlobalName[globalIndex] === nameEscaped && (now - lastGlobalTs[globalIndex]) < GLOBAL_TRACK_DEDUP_MS) {
+    return false;
+  }
+  noteGlobalTrack(globalIndex, nameEscaped, now);
+  return true;
 }
 
 // Debounce /reannounce so M4L doesn't get spammed
 let lastReannounceTs = 0;
 
-// Minimum interval between automatic full track-name sweeps
+// Track names are pulled from M4L as one snapshot: /request-tracknames <start> <count>
+// is answered with a single OSC bundle holding /tracknames <start> <count> and
+// one /trackname per track (see docs/M4L_TRACKNAME_HANDSHAKE.md). After that M4L
+// pushes renames as plain /trackname messages and structural changes (tracks
+// added, removed, moved) as /tracks-changed, which asks for a new snapshot, so
+// nothing is swept on a timer. Patches that predate the snapshot request never
+// answer it; after TRACK_SNAPSHOT_TIMEOUT_MS the old one-at-a-time sweep runs.
+const TRACK_COUNT = MAX_DEVICES * 8;
+const TRACK_SNAPSHOT_TIMEOUT_MS = 1500;
+let trackSnapshotTimer = null;        // pending /request-tracknames
+let trackSnapshotSupported = null;    // null until M4L answers (or doesn't)
+
+// Minimum interval between automatic full per-track sweeps (legacy patches)
 const TRACK_SWEEP_MIN_INTERVAL_MS = 5 * 60 * 1000; // 5 minutes
 let lastTrackSweepTs = 0;
 
@@ -63,28 +144,159 @@ function requestReannounce(forceSweep = false) {
   if (now - lastReannounceTs < 2000) return; // 2s gate for sending /reannounce
   lastReannounceTs = now;
   // try { sendOSC('/reannounce', []); } catch {}
-  // After sending /reannounce, start requesting track names from M4L
-  setTimeout(() => { startTrackNameRequests(forceSweep); }, 300);
+  // After sending /reannounce, pull the track names from M4L
+  setTimeout(() => { requestTrackNames(forceSweep); }, 300);
+}
+
+// Ask M4L for every track name in one round trip; a request already in flight
+// covers this one
+function requestTrackNames(forceSweep = false) {
+  if (trackSnapshotTimer) return;
+  if (trackSnapshotSupported === false) {
+    startTrackNameRequests(forceSweep);
+    return;
+  }
+  sendOSC('/request-tracknames', [{ type: 'i', value: 0 }, { type: 'i', value: TRACK_COUNT }]);
+  trackSnapshotTimer = setTimeout(() => {
+    trackSnapshotTimer = null;
+    trackSnapshotSupported = false;
+    log.warn('⚠️ No /tracknames bundle from M4L; falling back to per-track requests');
+    startTrackNameRequests(forceSweep);
+  }, TRACK_SNAPSHOT_TIMEOUT_MS);
+}
+
+// ---- Routing table ----
+// Which devices show which tracks, rebuilt by rebuildRoutes() whenever the
+// topology changes (a device connects or drops, a block is remapped), so a
+// message routes by index instead of scanning `devices`:
+//   blockRoutes[b]  - targets showing 8-track block b; empty when nobody
+//                     shows it, so no unit gets names it doesn't display
+//   activeRoutes[b] - { show, clear }: who gets /activetrack <local> and who
+//                     gets /activetrack -1 when a track in block b is selected
+// A target is { key, device, base, write }: track `at` of the block is panel
+// base + at % 8 on that device. A unit with more than one mux (SCREENS > 8)
+// shows consecutive blocks from its own, one per 8 panels, like the firmware's
+// DEVICE_ID offset. With no devices the legacy port is the only route.
+const TRACK_BLOCKS = TRACK_COUNT / 8;
+let blockRoutes = new Array(TRACK_BLOCKS).fill([]);
+let activeRoutes = new Array(TRACK_BLOCKS).fill({ show: [], clear: [] });
+let deviceById = new Map();
+const legacyRoute = [{ key: 0, device: null, base: 0, write: s => send(s) }];
+
+function deviceBlock(d) {
+  return typeof d.displayBlock === 'number' ? d.displayBlock : d.id;
+}
+
+// 8-track blocks a device shows
+function deviceSpan(d) {
+  return Math.max(1, Math.min(DEVICE_SCREENS_MAX, d.screens || 8) >> 3);
+}
+
+function rebuildRoutes() {
+  deviceById = new Map();
+  for (const d of devices) if (!deviceById.has(d.id)) deviceById.set(d.id, d);
+  const all = devices.map(d => ({ key: d.id, device: d, base: 0, write: s => writeDevice(d, s) }));
+  const byBlock = new Map();
+  for (const t of all) {
+    const first = deviceBlock(t.device);
+    const span = deviceSpan(t.device);
+    for (let k = 0; k < span; k++) {
+      if (!byBlock.has(first + k)) byBlock.set(first + k, []);
+      byBlock.get(first + k).push(k ? { ...t, base: k * 8 } : t);
+    }
+  }
+  blockRoutes = new Array(TRACK_BLOCKS);
+  activeRoutes = new Array(TRACK_BLOCKS);
+  for (let b = 0; b < TRACK_BLOCKS; b++) {
+    const shown = byBlock.get(b);
+    if (shown) {
+      blockRoutes[b] = shown;
+      activeRoutes[b] = { show: shown, clear: all.filter(t => !shown.some(x => x.device === t.device)) };
+    } else {
+      blockRoutes[b] = [];
+      // A lone device shows whatever is selected; otherwise nobody has it
+      activeRoutes[b] = all.length === 1 ? { show: all, clear: [] } : { show: [], clear: all };
+    }
+  }
+}
+
+// Devices showing 8-track block `block`
+function trackNameTargets(block) {
+  if (devices.length === 0) return serial && serial.isOpen ? legacyRoute : [];
+  return blockRoutes[block] || [];
 }
 
-// Request track names from M4L one at a time
+// Select global track `index` (0..TRACK_COUNT-1) on whichever device shows it
+function routeActiveTrack(index) {
+  if (devices.length === 0) {
+    send(`/activetrack ${index}\n`);
+    return;
+  }
+  const r = activeRoutes[Math.floor(index / 8)];
+  if (!r) return;
+  for (const t of r.show) {
+    try { t.write(`/activetrack ${t.base + index % 8}\n`); } catch (e) { log.error(`❌ /activetrack to Device ${t.key} failed: ${e.message}`); }
+  }
+  for (const t of r.clear) {
+    try { t.write('/activetrack -1\n'); } catch {}
+  }
+}
+
+// Apply a /tracknames bundle: tracks in [start, start + count) that the bundle
+// leaves out are blank. Every name goes into the store, but only blocks a
+// device displays produce /trackname lines (the legacy port shows block 0
+// only), so blanks for tracks beyond the rig never reach a screen. Each
+// device's changed names are queued together and leave in one bulk write.
+function applyTrackNameSnapshot(start, count, names) {
+  if (trackSnapshotTimer) { clearTimeout(trackSnapshotTimer); trackSnapshotTimer = null; }
+  trackSnapshotSupported = true;
+  const end = Math.min(TRACK_COUNT, start + count);
+  const batches = new Map(); // device key → { write, lines }
+  const now = Date.now();
+  for (let at = Math.max(0, start); at < end; at++) {
+    const nameStr = names.has(at) ? names.get(at) : '';
+    const escNorm = normalizeName(nameStr);
+    storeTrackName(at, nameStr);
+    noteGlobalTrack(at, escNorm, now);
+    const localIndex = at % 8;
+    const block = Math.floor(at / 8);
+    const shown = devices.length ? blockRoutes[block] : (block === 0 ? trackNameTargets(0) : []);
+    if (!shown.length) continue;
+    const esc = nameStr.replace(/"/g, '\\"');
+    for (const t of shown) {
+      const panel = t.base + localIndex;
+      if (!shouldSendTrackname(t.key, panel, escNorm)) continue;
+      if (!batches.has(t.key)) batches.set(t.key, { write: t.write, lines: [] });
+      batches.get(t.key).lines.push(`/trackname ${panel} "${esc}" ${at}\n`);
+    }
+  }
+  for (const [key, b] of batches) {
+    try { b.write(b.lines.join('')); } catch (e) { log.error(`❌ Track-name snapshot to Device ${key} failed: ${e.message}`); }
+  }
+  trackStoreSynced = true;
+  log.info(`✅ Track-name snapshot ${start}..${end - 1} applied (${[...batches.values()].reduce((n, b) => n + b.lines.length, 0)} changed)`);
+  wsBroadcast({ type: 'tracknames-snapshot', start, count: end - start });
+}
+
+// Legacy patches: request track names from M4L one at a time
 let trackRequestIndex = 0;
 let trackRequestTimer = null;
 function requestNextTrackName() {
-  if (trackRequestIndex >= 32) {
-    console.log('✅ Finished requesting all 32 track names from M4L');
+  if (trackRequestIndex >= TRACK_COUNT) {
+    log.info(`✅ Finished requesting all ${TRACK_COUNT} track names from M4L`);
     trackRequestIndex = 0;
+    trackStoreSynced = true;
     return;
   }
   try {
-    // Send 0-31 to M4L (matches Live API 0-based indexing)
+    // Send 0..TRACK_COUNT-1 to M4L (matches Live API 0-based indexing)
     sendOSC('/request-trackname', [{ type: 'i', value: trackRequestIndex }]);
-    console.log(`📤 Requested track name for index ${trackRequestIndex} (0-based) from M4L`);
+    log.debug(`📤 Requested track name for index ${trackRequestIndex} (0-based) from M4L`);
     trackRequestIndex++;
     // Wait 25ms before requesting next track (2x faster refresh)
     trackRequestTimer = setTimeout(requestNextTrackName, 25);
   } catch (e) {
-    console.error('Error requesting track name:', e);
+    log.error(`Error requesting track name: ${e.message}`);
   }
 }
 
@@ -92,7 +304,7 @@ function startTrackNameRequests(force = false) {
   const now = Date.now();
   if (!force && lastTrackSweepTs && (now - lastTrackSweepTs) < TRACK_SWEEP_MIN_INTERVAL_MS) {
     const secondsAgo = Math.round((now - lastTrackSweepTs) / 1000);
-    console.log(`⏭️  Skipping track-name sweep; last run ${secondsAgo}s ago (<${TRACK_SWEEP_MIN_INTERVAL_MS / 1000}s)`);
+    log.info(`⏭️  Skipping track-name sweep; last run ${secondsAgo}s ago (<${TRACK_SWEEP_MIN_INTERVAL_MS / 1000}s)`);
     return;
   }
   lastTrackSweepTs = now;
@@ -104,12 +316,90 @@ function startTrackNameRequests(force = false) {
 // Legacy single device variables (for backward compatibility)
 let serial = null;
 let serialPath = null;
-let serialBuf = '';
+const serialRx = { rx: null, rxLen: 0 };   // unterminated input on the legacy port
 let deviceVersion = null;
 
+// ---- WebSocket fan-out ----
+// Events are stringified once, queued per client and flushed every
+// WS_FRAME_MS as one frame ({ type: 'batch', events: [...] } when more than
+// one is waiting), so an OSC burst costs each browser one send per frame
+// rather than one per message. Clients choose topics with
+// { type: 'subscribe', topics: [...] }; by default they get everything.
+// A client whose socket has more than WS_MAX_BUFFERED unsent bytes (a slow
+// link, a backgrounded tab) is skipped until it drains. Its queue is capped
+// at WS_QUEUE_MAX events in all: it sheds the oldest osc/serial/log/progress
+// events first, then the oldest state events, and then tells it how many it
+// missed; nothing on the OSC or serial path ever waits on it. Sheddable and
+// state events sit in two fixed rings, tagged with an arrival number, so
+// shedding is a ring pop and the flush merges the two back into arrival order.
+const WS_FRAME_MS = 25;
+const WS_MAX_BUFFERED = 256 * 1024;
+const WS_QUEUE_MAX = 500;
+const WS_TOPICS = new Set(['osc', 'serial', 'log', 'progress', 'state']);
+const WS_TOPIC_OF = {
+  'osc-sent': 'osc', 'osc-received': 'osc',
+  'serial-data': 'serial', 'log': 'log', 'fwu-progress': 'progress', 'flash-progress': 'progress',
+};
+let wsFlushTimer = null;
+
+const wsRing = () => ({ buf: new Array(WS_QUEUE_MAX), head: 0, len: 0 });
+const wsRingAt = (r, i) => r.buf[(r.head + i) % WS_QUEUE_MAX];
+
+function wsRingShift(r) {
+  const e = r.buf[r.head];
+  r.buf[r.head] = undefined;
+  r.head = (r.head + 1) % WS_QUEUE_MAX;
+  r.len--;
+  return e;
+}
+
+function wsEnqueue(c, topic, s) {
+  if (c.readyState !== 1 || (c.topics && !c.topics.has(topic))) return;
+  const q = c.txq || (c.txq = { shed: wsRing(), state: wsRing(), seq: 0 });
+  if (q.shed.len + q.state.len >= WS_QUEUE_MAX) {
+    c.txDropped = (c.txDropped || 0) + 1;
+    if (q.shed.len) wsRingShift(q.shed);
+    else if (topic === 'state') wsRingShift(q.state);
+    else return;
+  }
+  const r = topic === 'state' ? q.state : q.shed;
+  r.buf[(r.head + r.len++) % WS_QUEUE_MAX] = { seq: q.seq++, s };
+  if (!wsFlushTimer) wsFlushTimer = setTimeout(wsFlush, WS_FRAME_MS);
+}
+
+function wsFlush() {
+  wsFlushTimer = null;
+  let pending = false;
+  for (const c of wss.clients) {
+    const q = c.txq;
+    if (!q || !(q.shed.len + q.state.len)) continue;
+    if (c.readyState !== 1) { c.txq = null; continue; }
+    if (c.bufferedAmount > WS_MAX_BUFFERED) { pending = true; continue; }
+    const parts = [];
+    if (c.txDropped) {
+      parts.push(JSON.stringify({ type: 'dropped', count: c.txDropped }));
+      c.txDropped = 0;
+    }
+    while (q.shed.len || q.state.len) {
+      const older = !q.state.len ||
+        (q.shed.len && wsRingAt(q.shed, 0).seq < wsRingAt(q.state, 0).seq) ? q.shed : q.state;
+      parts.push(wsRingShift(older).s);
+    }
+    try { c.send(parts.length === 1 ? parts[0] : `{"type":"batch","events":[${parts.join(',')}]}`); } catch {}
+  }
+  if (pending) wsFlushTimer = setTimeout(wsFlush, WS_FRAME_MS);
+}
+
+function wsBroadcast(obj) {
+  const topic = WS_TOPIC_OF[obj.type] || 'state';
+  const s = JSON.stringify(obj);
+  for (const c of wss.clients) wsEnqueue(c, topic, s);
+}
+
 const app = express();
 const server = http.createServer(app);
 const wss = new WebSocket.Server({ server });
+log.clients = wss.clients;
 
  // --- CORS allowlist for remote UI (e.g., GitHub Pages / Netlify) ---
  // Configure ALLOWED_ORIGINS as a comma-separated list, e.g.:
@@ -149,33 +439,50 @@ const wss = new WebSocket.Server({ server });
 // OSC UDP Port for broadcasting to Ableton M4L (lazy init)
 let udpPort = null;
 
-// De-duplication for /trackname forwarding
-// - Content-level: only forward if text changed for (deviceId, localIndex)
-// - Burst-level: also suppress identical repeats within a short window
-const lastTracknameValue = new Map(); // key: `${deviceId}:${localIndex}` → lastEscapedName
-const lastTracknameTime = new Map();  // key: `${deviceId}:${localIndex}:${name}` → timestamp
+// De-duplication for /trackname forwarding, per device slot (deviceId * DEVICE_SCREENS_MAX + localIndex)
+// - Content-level: only forward if text changed for the slot
+// - Burst-level: also suppress a name the slot was sent within TRACKNAME_DEDUP_MS
+//   (A → B → A flapping). Each slot remembers its last TRACKNAME_BURST_DEPTH
+//   sends in a small ring; older entries simply age out of the window.
 const TRACKNAME_DEDUP_MS = 4000;
+const TRACKNAME_BURST_DEPTH = 4;
+const lastTracknameValue = new Array(SCREEN_SLOTS).fill(null);
+const burstName = new Array(SCREEN_SLOTS * TRACKNAME_BURST_DEPTH).fill(null);
+const burstTs = new Float64Array(SCREEN_SLOTS * TRACKNAME_BURST_DEPTH);
+const burstHead = new Uint8Array(SCREEN_SLOTS);
 function shouldSendTrackname(deviceId, localIndex, nameEscaped) {
-  try {
-    const keySlot = `${deviceId}:${localIndex}`;
-    const keyBurst = `${deviceId}:${localIndex}:${nameEscaped}`;
-    const now = Date.now();
-    const prevValue = lastTracknameValue.get(keySlot);
-    if (prevValue === nameEscaped) {
-      // Same content already sent for this slot → skip
-      return false;
-    }
-    const prevTime = lastTracknameTime.get(keyBurst) || 0;
-    if (now - prevTime < TRACKNAME_DEDUP_MS) {
+  const local = Number(localIndex);
+  if (!(local >= 0 && local < DEVICE_SCREENS_MAX)) return true;
+  const slot = Number(deviceId) * DEVICE_SCREENS_MAX + local;
+  if (!(slot >= 0 && slot < SCREEN_SLOTS)) return true;
+  if (lastTracknameValue[slot] === nameEscaped) {
+    // Same content already sent for this slot → skip
+    return false;
+  }
+  const now = Date.now();
+  const base = slot * TRACKNAME_BURST_DEPTH;
+  for (let i = base; i < base + TRACKNAME_BURST_DEPTH; i++) {
+    if (burstName[i] === nameEscaped && now - burstTs[i] < TRACKNAME_DEDUP_MS) {
       // Burst duplicate of the exact same payload → skip
       return false;
     }
-    // Accept and record
-    lastTracknameValue.set(keySlot, nameEscaped);
-    lastTracknameTime.set(keyBurst, now);
-    return true;
-  } catch {
-    return true;
+  }
+  // Accept and record
+  lastTracknameValue[slot] = nameEscaped;
+  const at = base + burstHead[slot];
+  burstName[at] = nameEscaped;
+  burstTs[at] = now;
+  burstHead[slot] = (burstHead[slot] + 1) % TRACKNAME_BURST_DEPTH;
+  return true;
+}
+
+// A device that reconnects has lost its screen; let its slots be written again
+function forgetTrackSlots(deviceId) {
+  for (let i = 0; i < DEVICE_SCREENS_MAX; i++) {
+    const slot = Number(deviceId) * DEVICE_SCREENS_MAX + i;
+    if (!(slot >= 0 && slot < SCREEN_SLOTS)) continue;
+    lastTracknameValue[slot] = null;
+    burstName.fill(null, slot * TRACKNAME_BURST_DEPTH, (slot + 1) * TRACKNAME_BURST_DEPTH);
   }
 }
 
@@ -235,7 +542,6 @@ let lastActiveTrackIndex = null; // 0..31
 
 // Send OSC message to Ableton (M4L)
 function sendOSC(address, args = []) {
-    console.log(`[sendOSC] Called with address: ${address} and args: ${JSON.stringify(args)}`);
     const port = initOSC();
     if (!port) {
         console.error('❌ OSC port not initialized - cannot send', address);
@@ -254,8 +560,7 @@ function sendOSC(address, args = []) {
             args: args
         }, M4L_IP, M4L_PORT);
         const argsStr = args.length > 0 ? ' [' + args.map(a => a.value || a).join(', ') + ']' : '';
-        console.log(`[sendOSC] Successfully sent OSC message: ${address} with args: ${JSON.stringify(args)}`);
-        console.log(`📤 OSC → M4L (${M4L_IP}:${M4L_PORT}): ${address}${argsStr}`);
+        if (log.debugOn) log.debug(`📤 OSC → M4L (${M4L_IP}:${M4L_PORT}): ${address}${argsStr}`);
         
         // Broadcast to browser UI
         wsBroadcast({ 
@@ -265,8 +570,7 @@ function sendOSC(address, args = []) {
             argsStr: argsStr
         });
     } catch (err) {
-        console.error(`[sendOSC] Error sending OSC message: ${address} with args: ${JSON.stringify(args)}`, err.message, err.stack);
-        console.error(`❌ OSC send error (${address}):`, err.message, err.stack);
+        log.error(`❌ OSC send error (${address}): ${err.message}`);
     }
 }
 
@@ -308,6 +612,7 @@ function initOSCListener() {
                     if (abletonConnected) {
                         abletonConnected = false;
                         abletonGreetingSent = false; // allow re-announce on next handshake
+                        trackStoreSynced = false;    // the next set may be a different project
                         const idleSecs = Math.floor(ABLETON_IDLE_TIMEOUT_MS / 1000);
                         console.log(`⚠️ Ableton disconnected (no /hi in ${idleSecs}s)`);
                         wsBroadcast({ type: 'ableton-disconnected' });
@@ -326,18 +631,52 @@ function initOSCListener() {
             
             // Log raw packets for debugging
             oscListener.on("raw", (data, info) => {
-                console.log(`📦 RAW OSC packet received from ${info.address}:${info.port}, ${data.length} bytes`);
+                if (log.debugOn) log.debug(`📦 RAW OSC packet received from ${info.address}:${info.port}, ${data.length} bytes`);
             });
             
+            // A bundle led by /tracknames is a track-name snapshot: apply it as a
+            // whole here and mark its messages so the per-message route skips them
+            oscListener.on("bundle", (bundle, timeTag, info) => {
+                const packets = (bundle.packets || []).filter(p => p.address);
+                const head = packets.find(p => p.address === "/tracknames");
+                if (!head) return;
+                const start = Number(head.args?.[0]?.value ?? 0);
+                const count = Number(head.args?.[1]?.value ?? TRACK_COUNT);
+                if (!Number.isFinite(start) || !Number.isFinite(count)) return;
+                const names = new Map();
+                for (const p of packets) {
+                    p.inSnapshot = true;
+                    if (p.address !== "/trackname" || !p.args || p.args.length < 2) continue;
+                    // Same index rules as a single /trackname: a third arg of 1..TRACK_COUNT is 1-based
+                    const atRaw = p.args.length >= 3 ? Number(p.args[2].value) : NaN;
+                    let at = Number(p.args[0].value);
+                    if (atRaw >= 1 && atRaw <= TRACK_COUNT) at = atRaw - 1;
+                    else if (atRaw === 0) at = 0;
+                    if (!Number.isFinite(at) || at < 0 || at >= TRACK_COUNT) continue;
+                    let nameStr = String(p.args[1].value ?? '').trim();
+                    if (nameStr.length >= 2 && nameStr.startsWith('"') && nameStr.endsWith('"')) nameStr = nameStr.slice(1, -1);
+                    names.set(at, nameStr);
+                }
+                lastHiTime = Date.now();
+                if (!abletonConnected) {
+                    abletonConnected = true;
+                    wsBroadcast({ type: 'ableton-connected' });
+                }
+                log.info(`📨 Received /tracknames bundle ${start}+${count} (${names.size} names) from ${info.address}:${info.port}`);
+                applyTrackNameSnapshot(start, count, names);
+            });
+
             oscListener.on("message", (oscMsg, timeTag, info) => {
+                if (oscMsg.inSnapshot) return;
                 const fromIP = info.address || 'unknown';
                 const fromPort = info.port || 'unknown';
                 
-                // Format args for display
-                const argsStr = oscMsg.args && oscMsg.args.length > 0 
-                    ? oscMsg.args.map(a => a.value).join(', ') 
-                    : '';
-                console.log(`📨 Received OSC: ${oscMsg.address}${argsStr ? ' [' + argsStr + ']' : ''} from ${fromIP}:${fromPort}`);
+                if (log.debugOn) {
+                    const argsStr = oscMsg.args && oscMsg.args.length > 0
+                        ? oscMsg.args.map(a => a.value).join(', ')
+                        : '';
+                    log.debug(`📨 Received OSC: ${oscMsg.address}${argsStr ? ' [' + argsStr + ']' : ''} from ${fromIP}:${fromPort}`);
+                }
                 
                 wsBroadcast({ type: 'osc-received', from: `${fromIP}:${fromPort}`, address: oscMsg.address, args: oscMsg.args });
                 
@@ -358,7 +697,7 @@ function initOSCListener() {
                     const wasConnected = abletonConnected;
                     abletonConnected = true;
                     
-                    console.log(`✓ Received /hi from M4L (port ${OSC_LISTEN_PORT})`);
+                    log.info(`✓ Received /hi from M4L (port ${OSC_LISTEN_PORT})`);
                     
                     // Send /ableton_on EVERY time we get /hi (triggers heartbeat flash)
                     try {
@@ -366,7 +705,9 @@ function initOSCListener() {
                     } catch (err) {}
                     
                     if (!wasConnected) {
-                        console.log('✅ Ableton Live connected via OSC handshake');
+                        log.info('✅ Ableton Live connected via OSC handshake');
+                        // The patch may have been swapped while we were apart
+                        trackSnapshotSupported = null;
                         wsBroadcast({ type: 'ableton-connected' });
                         // Mark greeting as sent so we stop sending /hello periodically
                         abletonGreetingSent = true;
@@ -386,11 +727,18 @@ function initOSCListener() {
                       if (!lastReannounceTs || (now - lastReannounceTs) >= 2000) {
                         lastReannounceTs = now;
                         // Force a track-name sweep even if we ran one recently.
-                        setTimeout(() => { try { startTrackNameRequests(true); } catch {} }, 500);
+                        setTimeout(() => { try { requestTrackNames(true); } catch {} }, 500);
                       }
                     } catch {}
                     return;
                 }
+
+                // Tracks were added, removed or reordered in Live: names moved
+                // between indices, so pull a fresh snapshot
+                if (oscMsg.address === "/tracks-changed") {
+                    try { requestTrackNames(true); } catch {}
+                    return;
+                }
                 
                 // Forward OSC commands to device via serial
                 if (oscMsg.address === "/trackname" && oscMsg.args.length >= 2) { // Handle 2 or 3 args
@@ -399,17 +747,17 @@ function initOSCListener() {
                     const atRaw = oscMsg.args.length >= 3 ? Number(oscMsg.args[2].value) : NaN;
                     let at;
                     if (Number.isFinite(atRaw)) {
-                      if (atRaw >= 1 && atRaw <= 32) at = atRaw - 1; // normalize 1..32 → 0..31
-                      else if (atRaw >= 0 && atRaw < 32) at = atRaw;  // already 0..31
+                      if (atRaw >= 1 && atRaw <= TRACK_COUNT) at = atRaw - 1; // normalize 1-based → 0-based
+                      else if (atRaw === 0) at = 0;
                     }
                     if (!Number.isFinite(at)) {
                       const di = Number(displayIndex);
-                      if (Number.isFinite(di) && di >= 0 && di < 32) {
-                        // Bridge sends 0-31, M4L echoes back 0-31
-                        at = di;  // use displayIndex directly (0-31)
+                      if (Number.isFinite(di) && di >= 0 && di < TRACK_COUNT) {
+                        // Bridge sends 0-based, M4L echoes back 0-based
+                        at = di;  // use displayIndex directly
                       }
                     }
-                    if (!Number.isFinite(at) || at < 0 || at >= 32) return;
+                    if (!Number.isFinite(at) || at < 0 || at >= TRACK_COUNT) return;
 
                     // Do not override authoritative actualTrack from M4L.
 
@@ -422,77 +770,38 @@ function initOSCListener() {
                     const escNorm = normalizeName(nameStr);
                     const globalIndex = at;
                     if (!shouldForwardGlobal(globalIndex, escNorm)) {
-                      console.log(`⏭️  Deduped global /trackname for track ${globalIndex}`);
+                      log.debug(`⏭️  Deduped global /trackname for track ${globalIndex}`);
                       return;
                     }
                     
-                    if (Number.isFinite(at) && at >= 0 && at < 32) {
-                      try { globalTrackNames[globalIndex] = nameStr; } catch {}
-                    }
+                    storeTrackName(globalIndex, nameStr);
                     const block = Math.floor(at / 8);
                     const localIndex = at % 8;
-                    try { uiLog(`[ROUTE] /trackname di=${displayIndex} atRaw=${isNaN(atRaw)?'NaN':atRaw} → at=${at} block=${block} local=${localIndex}`); } catch {}
-                    const matched = devices.filter(d => (typeof d.displayBlock === 'number' ? d.displayBlock : d.id) === block);
-
-                    if (matched.length > 0) {
-                        const cmd = `/trackname ${localIndex} "${esc}" ${at}\n`;
-                        const delay = Math.max(0, (Number.isFinite(localIndex) ? localIndex : 0) * 100);
-                        matched.forEach(d => {
-                          if (shouldSendTrackname(d.id, localIndex, escNorm)) {
-                            setTimeout(() => sendToDevice(d.id, cmd), delay);
-                            console.log(`📍 Routed track ${at} to Device ${d.id} (block ${block}, local ${localIndex}, delay ${delay}ms)`);
-                          }
-                        });
-                    } else if (devices.length > 0) {
-                        // Fallback for single connected device if routing fails
-                        const fallbackId = devices[0].id;        
-                        if (shouldSendTrackname(fallbackId, localIndex, escNorm)) {
-                          const cmd = `/trackname ${localIndex} "${esc}" ${at}\n`;
-                          const delay = Math.max(0, (Number.isFinite(localIndex) ? localIndex : 0) * 100);
-                          setTimeout(() => sendToDevice(fallbackId, cmd), delay);
-                        } else {
-                          console.log(`⏭️  Deduped /trackname for fallback Device ${fallbackId} idx ${displayIndex}`);
-                        }
-                    } else {
-                        // Single device mode (legacy)
-                        if (serial && serial.isOpen) {
-                            if (shouldSendTrackname(0, localIndex, escNorm)) {
-                              const cmd = `/trackname ${localIndex} "${esc}" ${at}\n`;
-                              const delay = Math.max(0, (Number.isFinite(localIndex) ? localIndex : 0) * 100);
-                              setTimeout(() => send(cmd), delay);
-                            } else {
-                              console.log(`⏭️  Deduped /trackname for legacy serial idx ${displayIndex}`);
-                            }
-                        } else {
-                            // Silently ignore if the single-device serial port isn't open
+                    if (log.debugOn) uiLog(`[ROUTE] /trackname di=${displayIndex} atRaw=${isNaN(atRaw)?'NaN':atRaw} → at=${at} block=${block} local=${localIndex}`, 'debug');
+
+                    // Straight onto each device's write queue; slots are not staggered
+                    for (const t of trackNameTargets(block)) {
+                        const panel = t.base + localIndex;
+                        if (!shouldSendTrackname(t.key, panel, escNorm)) {
+                            log.debug(`⏭️  Deduped /trackname for Device ${t.key} idx ${displayIndex}`);
+                            continue;
                         }
+                        try { t.write(`/trackname ${panel} "${esc}" ${at}\n`); } catch (e) { log.error(`❌ /trackname to Device ${t.key} failed: ${e.message}`); continue; }
+                        if (log.debugOn) log.debug(`📍 Routed track ${at} to Device ${t.key} (block ${block}, local ${localIndex})`);
                     }
                 }
                 else if (oscMsg.address === "/activetrack" && oscMsg.args.length >= 1) {
                     const index = oscMsg.args[0].value;
-                    // Ignore /activetrack 99 or any value outside 0-31
-                    if (!Number.isFinite(index) || index < 0 || index >= 32 || index === 99) {
-                      console.log(`⚠️ Ignoring /activetrack ${index} (out of range or 99)`);
+                    // Ignore /activetrack 99 (M4L's "no track" marker, so track 100
+                    // can't be highlighted) or any value outside the routed range
+                    if (!Number.isFinite(index) || index < 0 || index >= TRACK_COUNT || index === 99) {
+                      log.debug(`⚠️ Ignoring /activetrack ${index} (out of range or 99)`);
                       return;
                     }
                     lastActiveTrackIndex = index;
-                    const block = Math.floor(index / 8);
-                    const localIndex = index % 8;
-                    if (devices && devices.length > 0) {
-                      const matched = devices.filter(d => (typeof d.displayBlock === 'number' ? d.displayBlock : d.id) === block);
-                      // Set active on matched devices, clear others
-                      if (matched.length > 0) {
-                        matched.forEach(d => sendToDevice(d.id, `/activetrack ${localIndex}\n`));
-                        devices.filter(d => !matched.includes(d))
-                               .forEach(d => sendToDevice(d.id, `/activetrack -1\n`));
-                      } else if (devices.length === 1) {
-                        sendToDevice(devices[0].id, `/activetrack ${localIndex}\n`);
-                      } else {
-                        sendToAll(`/activetrack -1\n`);
-                      }
-                    } else {
-                    send(`/activetrack ${index}\n`);
-                    }
+                    scheduleTrackStoreFlush();
+                    // Set active on the devices showing it, clear the others
+                    routeActiveTrack(index);
                 }
                 else if (oscMsg.address === "/ping") {
                     send(`/ping\n`);
@@ -600,70 +909,210 @@ app.use(express.static(path.join(__dirname, 'web')));
 const ASSETS_DIR = path.join(__dirname, 'assets');
 app.use('/assets', express.static(ASSETS_DIR));
 
-// Resolve Python command for firmware flashing
-// - On Windows, prefer an embedded python.exe in a local 'python' subfolder
-// - Otherwise, fall back to system 'python' on PATH
-function getPythonCommand() {
+// -------- USB flashing (esptool) --------
+// Each target port gets its own esptool process. FLASH_CONCURRENCY caps how
+// many write at once so several units behind one hub do not starve each
+// other. An image is downloaded once per URL into cache/firmware and shared
+// by every worker; progress goes out per port as 'flash-progress'.
+const FLASH_CONCURRENCY = Math.max(1, Number(process.env.FLASH_CONCURRENCY) || 4);
+const FLASH_CACHE_DIR = path.join(__dirname, 'cache', 'firmware');
+const FLASH_CACHE_TTL_MS = 60 * 60 * 1000;  // refetch after this, for "latest" style URLs
+const flashingPorts = new Set();             // ports reserved by a running flash (autoconnect skips them)
+const flashWaiters = [];
+const firmwareFetches = new Map();           // url -> pending download
+let flashRunning = 0;
+let esptoolCmd = null;                       // first runner that actually started esptool
+
+function acquireFlashSlot() {
+  if (flashRunning < FLASH_CONCURRENCY) { flashRunning++; return Promise.resolve(); }
+  return new Promise(resolve => flashWaiters.push(resolve));
+}
+
+function releaseFlashSlot() {
+  const next = flashWaiters.shift();
+  if (next) next(); else flashRunning--;
+}
+
+// Plain (un-gzip'd) image for url, downloaded at most once however many
+// ports ask for it
+function cachedFirmware(url) {
+  const key = crypto.createHash('sha1').update(url).digest('hex').slice(0, 16);
+  const dest = path.join(FLASH_CACHE_DIR, key + '.bin');
   try {
-    if (process.platform === 'win32') {
-      const embeddedPython = path.join(__dirname, 'python', 'python.exe');
-      if (fs.existsSync(embeddedPython)) {
-        console.log(`[FLASH] Using embedded Python at: ${embeddedPython}`);
-        return `"${embeddedPython}"`;
-      }
+    if (Date.now() - fs.statSync(dest).mtimeMs < FLASH_CACHE_TTL_MS) return Promise.resolve(dest);
+  } catch {}
+  if (firmwareFetches.has(url)) return firmwareFetches.get(url);
+  const pending = (async () => {
+    uiLog(`[FLASH] Downloading firmware from ${url}...`);
+    const tmpPath = await fetchToTemp(url);
+    try {
+      const plain = plainFirmware(await fs.promises.readFile(tmpPath));
+      await fs.promises.mkdir(FLASH_CACHE_DIR, { recursive: true });
+      await fs.promises.writeFile(dest + '.tmp', plain);
+      await fs.promises.rename(dest + '.tmp', dest);
+      uiLog(`[FLASH] Cached ${plain.length} byte image as cache/firmware/${path.basename(dest)}`);
+      return dest;
+    } finally {
+      fs.promises.unlink(tmpPath).catch(() => {});
     }
-  } catch (e) {
-    console.warn('[FLASH] Embedded Python check failed:', e.message);
-  }
-  console.log('[FLASH] Falling back to system "python" on PATH');
-  return 'python';
+  })();
+  firmwareFetches.set(url, pending);
+  pending.finally(() => firmwareFetches.delete(url)).catch(() => {});
+  return pending;
 }
 
-app.post('/api/firmware/flash', async (req, res) => {
-  const { devicePath, firmwareUrl, offset: offsetOverride, fullErase } = req.body;
-  if (!devicePath || !firmwareUrl) {
-    return res.status(400).json({ ok: false, error: 'Missing device path or firmware URL.' });
+// Bundled esptool first, then the embedded Python on Windows, then whatever
+// is on PATH. The runner that worked last time goes first.
+function esptoolRunners(args) {
+  const localEsptool = path.join(__dirname, 'bin', process.platform === 'win32' ? 'esptool.exe' : 'esptool');
+  const embeddedPython = path.join(__dirname, 'python', 'python.exe');
+  const runners = [{ cmd: localEsptool, args }];
+  if (process.platform === 'win32' && fs.existsSync(embeddedPython)) {
+    runners.push({ cmd: embeddedPython, args: ['-m', 'esptool', ...args] });
   }
+  for (const py of ['python', 'py', 'python3']) runners.push({ cmd: py, args: ['-m', 'esptool', ...args] });
+  runners.push({ cmd: 'esptool.py', args });
+  const last = runners.findIndex(r => r.cmd === esptoolCmd);
+  if (last > 0) runners.unshift(...runners.splice(last, 1));
+  return runners;
+}
 
-  const device = devices.find(d => d.path === devicePath);
-  if (!device) {
-    return res.status(404).json({ ok: false, error: 'Device not found or not connected.' });
+// One esptool invocation. Only falls through to the next runner when the
+// previous one never got esptool going (missing binary or module); a real
+// flashing error is final.
+async function runEsptool(args, portPath, progress) {
+  let lastErr = null;
+  for (const r of esptoolRunners(args)) {
+    let started = false;
+    try {
+      await new Promise((resolve, reject) => {
+        const child = spawn(r.cmd, r.args, { windowsHide: true, stdio: ['ignore', 'pipe', 'pipe'] });
+        let tail = '';
+        const onData = d => {
+          const lines = (tail + d.toString()).split(/[\r\n]+/);
+          tail = lines.pop();
+          for (const raw of lines) {
+            const line = raw.trim();
+            if (!line) continue;
+            if (/^esptool(\.py)?\s+v?\d|^Serial port\s/i.test(line)) started = true;
+            const m = /^Writing at 0x[0-9a-f]+\.*\s*\(\s*(\d+)\s*%\)/i.exec(line);
+            if (m) { progress('writing', Number(m[1])); continue; }
+            if (/^Erasing flash/i.test(line)) progress('erasing', 0);
+            uiLog(`[esptool ${portPath}] ${line}`);
+          }
+        };
+        child.stdout.on('data', onData);
+        child.stderr.on('data', onData);
+        child.on('error', reject);
+        child.on('close', code => code === 0 ? resolve() : reject(new Error(`esptool exit ${code}`)));
+      });
+      esptoolCmd = r.cmd;
+      return;
+    } catch (e) {
+      if (started) throw e;
+      lastErr = e;
+    }
   }
+  throw new Error(`esptool not available (${lastErr ? lastErr.message : 'no runner'})`);
+}
 
-  // 1. Disconnect the device to free up the serial port
-  uiLog(`[FLASH] Disconnecting ${devicePath} to begin flashing...`);
+// Free a port for esptool: close whichever serial handle has it open and
+// drop it from the device list
+async function releaseFlashPort(portPath) {
+  const device = devices.find(d => d.path === portPath);
   try {
-    if (device.serial && device.serial.isOpen) {
-      await new Promise(resolve => device.serial.close(resolve));
+    if (device && device.serial && device.serial.isOpen) {
+      await new Promise(resolve => device.serial.close(() => resolve()));
+    } else if (serial && serial.isOpen && serialPath === portPath) {
+      await new Promise(resolve => serial.close(() => resolve()));
     }
-    // Remove from our active list
-    devices = devices.filter(d => d.path !== devicePath);
-    wsBroadcast({ type: 'serial-close', path: devicePath });
-    uiLog(`[FLASH] Port ${devicePath} is now free.`);
   } catch (e) {
-    console.error(`[FLASH] Error closing port ${devicePath}:`, e);
-    return res.status(500).json({ ok: false, error: `Failed to close serial port: ${e.message}` });
+    uiLog(`[FLASH] Error closing ${portPath}: ${e.message}`, 'warn');
+  }
+  if (device) {
+    devices = devices.filter(d => d !== device);
+    rebuildRoutes();
+    wsBroadcast({ type: 'serial-close', path: portPath });
   }
+}
 
-  // 2. Download firmware to a temporary file
-  let tmpFile;
+async function flashPort(target, fwPath, opts) {
+  let last = '';
+  const progress = (stage, pct, error) => {
+    const key = `${stage}:${pct}`;
+    if (key === last) return;
+    last = key;
+    wsBroadcast({ type: 'flash-progress', path: target.path, deviceId: target.deviceId, stage, pct, ...(error ? { error } : {}) });
+  };
+  progress('queued', 0);
+  await acquireFlashSlot();
   try {
-    uiLog(`[FLASH] Downloading firmware from ${firmwareUrl}...`);
-    const response = await axios.get(firmwareUrl, { responseType: 'arraybuffer' });
-    tmpFile = tmp.fileSync({ postfix: '.bin' });
-    fs.writeFileSync(tmpFile.name, response.data);
-    uiLog(`[FLASH] Firmware saved to temporary file: ${tmpFile.name}`);
+    const t0 = Date.now();
+    const base = ['--chip', 'esp32c3', '--port', target.path, '--baud', String(opts.baud)];
+    if (opts.fullErase) await runEsptool([...base, 'erase_flash'], target.path, progress);
+    await runEsptool([...base, 'write_flash', '-z', opts.offset, fwPath], target.path, progress);
+    progress('done', 100);
+    uiLog(`[FLASH] ${target.path}: written in ${((Date.now() - t0) / 1000).toFixed(1)}s. Device will reboot.`);
   } catch (e) {
-    console.error(`[FLASH] Firmware download failed:`, e);
-    if (tmpFile) tmpFile.removeCallback();
-    return res.status(500).json({ ok: false, error: `Firmware download failed: ${e.message}` });
+    progress('failed', null, e.message);
+    throw e;
+  } finally {
+    releaseFlashSlot();
+  }
+}
+
+// Flash the image at url to every port in portPaths, FLASH_CONCURRENCY at a
+// time. Resolves with a per-port report; throws with code 'BUSY' if one of
+// the ports is already being flashed.
+async function flashFleet(portPaths, url, opts) {
+  const busy = portPaths.filter(p => flashingPorts.has(p));
+  if (busy.length) {
+    const e = new Error(`Another flash is in progress on ${busy.join(', ')}. Please wait.`);
+    e.code = 'BUSY';
+    throw e;
+  }
+  const targets = portPaths.map(p => {
+    const d = devices.find(x => x.path === p);
+    return { path: p, deviceId: d ? d.id : null };
+  });
+  targets.forEach(t => flashingPorts.add(t.path));
+  try {
+    const fwPath = await cachedFirmware(url);
+    await Promise.all(targets.map(t => releaseFlashPort(t.path)));
+    uiLog(`[FLASH] Flashing ${targets.length} device(s), ${Math.min(targets.length, FLASH_CONCURRENCY)} at a time`);
+    const t0 = Date.now();
+    const results = await Promise.allSettled(targets.map(t => flashPort(t, fwPath, opts)));
+    const report = targets.map((t, i) => results[i].status === 'fulfilled'
+      ? { path: t.path, ok: true }
+      : { path: t.path, ok: false, error: results[i].reason.message });
+    report.filter(r => !r.ok).forEach(r => uiLog(`[FLASH] ${r.path} failed: ${r.error}`, 'error'));
+    uiLog(`[FLASH] Finished ${report.filter(r => r.ok).length}/${report.length} in ${((Date.now() - t0) / 1000).toFixed(1)}s`);
+    return report;
+  } finally {
+    targets.forEach(t => flashingPorts.delete(t.path));
+  }
+}
+
+function flashResponse(res, report) {
+  const failed = report.find(r => !r.ok);
+  res.status(failed ? 500 : 200).json({ ok: !failed, devices: report, ...(failed ? { error: `${failed.path}: ${failed.error}` } : {}) });
+}
+
+app.post('/api/firmware/flash', async (req, res) => {
+  const { devicePath, devicePaths, firmwareUrl, offset: offsetOverride, fullErase } = req.body;
+  const portPaths = Array.isArray(devicePaths) && devicePaths.length ? devicePaths : (devicePath ? [devicePath] : []);
+  if (!portPaths.length || !firmwareUrl) {
+    return res.status(400).json({ ok: false, error: 'Missing device path or firmware URL.' });
+  }
+  const missing = portPaths.filter(p => !devices.some(d => d.path === p));
+  if (missing.length) {
+    return res.status(404).json({ ok: false, error: `Device not found or not connected: ${missing.join(', ')}` });
   }
 
-  // 3. Execute esptool.py (write at detected/selected offset). Avoid full erase by default.
-  const pythonCmd = getPythonCommand();
+  // Write at the detected/selected offset. Avoid full erase by default.
   let offset = '0x10000';
   try {
-    const fname = new URL(firmwareUrl).pathname.split('/').pop().toLowerCase();
+    const fname = new URL(firmwareUrl).pathname.split('/').pop().toLowerCase().replace(/\.gz$/, '');
     if (offsetOverride && (offsetOverride === '0x0' || offsetOverride === '0x10000')) {
       offset = offsetOverride;
     } else if (/factory|merged|all/.test(fname)) {
@@ -675,37 +1124,13 @@ app.post('/api/firmware/flash', async (req, res) => {
     }
   } catch {}
 
-  const base = `${pythonCmd} -m esptool --chip esp32c3 --port ${devicePath} --baud 460800`;
-  const cmds = [];
-  if (fullErase) cmds.push(`${base} erase_flash`);
-  cmds.push(`${base} write_flash -z ${offset} "${tmpFile.name}"`);
-  const fullCmd = cmds.join(' && ');
-  uiLog(`[FLASH] Executing: ${fullCmd}`);
-  const child = exec(fullCmd, { windowsHide: true });
-
-  child.stdout.on('data', (data) => {
-    const output = data.toString();
-    console.log(`[esptool]: ${output.trim()}`);
-    uiLog(`[esptool] ${output.trim()}`);
-  });
-  child.stderr.on('data', (data) => {
-    const output = data.toString();
-    console.error(`[esptool]: ${output.trim()}`);
-    uiLog(`[esptool] ${output.trim()}`);
-  });
-
-  child.on('close', (code) => {
-    uiLog(`[FLASH] esptool.py process finished with exit code ${code}.`);
-    tmpFile.removeCallback();
-
-    if (code === 0) {
-      uiLog(`[FLASH] Firmware update successful! Device will reboot.`);
-      res.json({ ok: true, message: 'Flash successful!' });
-    } else {
-      uiLog(`[FLASH] esptool.py failed. Please check the log.`);
-      res.status(500).json({ ok: false, error: 'esptool.py failed. See log for details.' });
-    }
-  });
+  try {
+    const report = await flashFleet(portPaths, firmwareUrl, { offset, fullErase: !!fullErase, baud: 460800 });
+    flashResponse(res, report);
+  } catch (e) {
+    log.error(`[FLASH] Error: ${e.message}`);
+    res.status(e.code === 'BUSY' ? 429 : 500).json({ ok: false, error: e.message });
+  }
 });
 
 app.get('/api/firmware/releases', async (req, res) => {
@@ -765,14 +1190,10 @@ app.get('/favicon.ico', (req, res) => {
   res.redirect(301, '/favicon.svg');
 });
 
-function wsBroadcast(obj) {
-  const s = JSON.stringify(obj);
-  for (const c of wss.clients) if (c.readyState === 1) c.send(s);
-}
-
-// Helper: print a line to the Serial Monitor area in the web UI
-function uiLog(line) {
-  try { wsBroadcast({ type: 'serial-data', data: line }); } catch {}
+// Helper: print a line to the Serial Monitor area in the web UI (and the log ring)
+function uiLog(line, level = 'info') {
+  if (level === 'debug' && !log.debugOn) return;
+  try { log.emit(level, line, true); } catch {}
 }
 
 let shutdownRequested = false;
@@ -814,11 +1235,13 @@ async function gracefulShutdown(reason) {
       
       await Promise.all(closePromises);
       devices = [];
+      rebuildRoutes();
       serial = null;
       console.log('✓ All serial ports closed.');
     } catch (e) {
       console.error('Error closing ports:', e.message);
     }
+    try { flushTrackStoreSync(); } catch {}
     try {
       wss.clients.forEach(c => {
         try { c.close(); } catch {}
@@ -880,47 +1303,86 @@ async function openSerial(desiredPath) {
   return serialPath;
 }
 
+// Per-port write queue. One write is on a port at a time and the next goes
+// out from its drain callback, so nothing waits on a timer while the link is
+// idle. Lines queued behind a write in flight leave together as one bulk
+// write (the firmware splits lines out of its 4 KB serial RX buffer), and a
+// /trackname for a slot that is still queued replaces the queued one, so a
+// burst of renames only sends the last. q.slots maps a /trackname slot to
+// the absolute position of its queued line (q.head counts lines already
+// written), so finding it is a lookup rather than a scan of the queue.
+const TX_BULK_MAX = 2048; // bytes per write, half the firmware's serial RX buffer
+
+function writeQueued(port, s) {
+  const q = port.txq || (port.txq = { lines: [], head: 0, slots: new Map(), busy: false });
+  for (const part of String(s).split('\n')) {
+    if (!part) continue;
+    const line = part + '\n';
+    const slot = /^\/trackname (\d+) /.exec(line);
+    const at = slot ? q.slots.get(slot[1]) : undefined;
+    if (at !== undefined && at >= q.head) { q.lines[at - q.head] = line; continue; }
+    if (slot) q.slots.set(slot[1], q.head + q.lines.length);
+    q.lines.push(line);
+  }
+  if (!q.busy) pumpWrites(port);
+}
+
+function pumpWrites(port) {
+  const q = port.txq;
+  if (!port.isOpen) { q.lines.length = 0; q.slots.clear(); q.busy = false; return; }
+  if (!q.lines.length) { q.busy = false; return; }
+  let n = 0, size = 0;
+  while (n < q.lines.length && (n === 0 || size + q.lines[n].length <= TX_BULK_MAX)) size += q.lines[n++].length;
+  q.busy = true;
+  const chunk = q.lines.splice(0, n).join('');
+  // Slots at positions below head are gone; once the queue is empty none remain
+  q.head += n;
+  if (!q.lines.length) q.slots.clear();
+  port.write(chunk, (err) => {
+    if (err) log.error(`❌ Serial write failed (${port.path}): ${err.message}`);
+  });
+  port.drain(() => pumpWrites(port));
+}
+
 function send(s) {
   if (!serial || !serial.isOpen) {
     console.error('❌ Cannot send - Serial not open');
     throw new Error('Serial not open');
   }
-  serial.write(s);
-  console.log(`SENT: ${s.trim()}`);
-  uiLog(`[SERIAL] SENT: ${s.trim()}`);
+  writeQueued(serial, s);
+  if (log.debugOn) uiLog(`[SERIAL] SENT: ${s.trim()}`, 'debug');
 }
 
 // Multi-device: Send to specific device by ID
 function sendToDevice(deviceId, s) {
-  console.log(`🔍 [sendToDevice] Attempting to send to deviceId=${deviceId}`);
-  console.log(`🔍 [sendToDevice] Current devices array:`, devices.map(d => `[id=${d.id}, path=${d.path}, serial=${d.serial ? 'open' : 'null'}]`).join(', '));
-  
-  const device = devices.find(d => d.id === deviceId);
+  const device = deviceById.get(deviceId);
   if (!device) {
     console.error(`❌ Device with id=${deviceId} not found in devices array`);
     throw new Error(`Device ${deviceId} not found`);
   }
+  writeDevice(device, s);
+}
+
+function writeDevice(device, s) {
   if (!device.serial) {
-    console.error(`❌ Device ${deviceId} has no serial object`);
-    throw new Error(`Device ${deviceId} has no serial connection`);
+    log.error(`❌ Device ${device.id} has no serial object`);
+    throw new Error(`Device ${device.id} has no serial connection`);
   }
   if (!device.serial.isOpen) {
-    console.error(`❌ Device ${deviceId} serial port is not open`);
-    throw new Error(`Device ${deviceId} serial port closed`);
+    log.error(`❌ Device ${device.id} serial port is not open`);
+    throw new Error(`Device ${device.id} serial port closed`);
   }
   
-  device.serial.write(s);
-  console.log(`✅ SENT to Device ${deviceId} (${device.path}): ${s.trim()}`);
-  uiLog(`[Device ${deviceId}] SENT: ${s.trim()}`);
+  writeQueued(device.serial, s);
+  if (log.debugOn) uiLog(`[Device ${device.id}] SENT: ${s.trim()}`, 'debug');
 }
 
 // Multi-device: Send to all connected devices
 function sendToAll(s) {
   devices.forEach(device => {
     if (device.serial && device.serial.isOpen) {
-      device.serial.write(s);
-      console.log(`SENT to Device ${device.id}: ${s.trim()}`);
-      uiLog(`[Device ${device.id}] SENT: ${s.trim()}`);
+      writeQueued(device.serial, s);
+      if (log.debugOn) uiLog(`[Device ${device.id}] SENT: ${s.trim()}`, 'debug');
     }
   });
 }
@@ -946,6 +1408,13 @@ function maybeReannounceBatch() {
       return;
     }
 
+    // Live already gave us every name this session; reconnecting devices are
+    // replayed from the track store instead
+    if (trackStoreSynced) {
+      batchReannounceDone = true;
+      return;
+    }
+
     // If we know how many devices to expect, wait until they are all connected
     if (expectedDeviceCount > 0) {
       if (connectedCount >= expectedDeviceCount) {
@@ -966,61 +1435,189 @@ function maybeReannounceBatch() {
   } catch {}
 }
 
+// OLED_Diagnostic prints one "DIAG: {json}" summary per bus characterisation
+// run. Keep the latest per port on disk so marginal units can be compared.
+const DIAGNOSTICS_PATH = path.join(__dirname, 'diagnostics.json');
+
+function storeDiagnostic(portPath, line) {
+  const m = /^DIAG\s*:\s*(\{.*\})\s*$/.exec(line);
+  if (!m) return false;
+  try {
+    const summary = JSON.parse(m[1]);
+    let all = {};
+    try { all = JSON.parse(fs.readFileSync(DIAGNOSTICS_PATH, 'utf8')) || {}; } catch {}
+    const key = portPath || 'unknown';
+    all[key] = { ts: new Date().toISOString(), summary };
+    fs.writeFileSync(DIAGNOSTICS_PATH, JSON.stringify(all, null, 2), 'utf8');
+    wsBroadcast({ type: 'diagnostic-summary', path: key, summary });
+    uiLog(`DIAG: stored bus characterisation for ${key}`);
+  } catch (e) {
+    log.warn(`DIAG: could not store summary: ${e.message}`);
+  }
+  return true;
+}
+
+// ---- Serial line framing ----
+// Each port keeps the unterminated end of its input in a fixed rx Buffer
+// (SERIAL_LINE_MAX bytes, allocated once). A chunk is appended there only
+// while a line is pending; otherwise it is scanned where it lies. Complete
+// lines are decoded in one toString() and walked with an offset cursor, so
+// a burst costs the same per line however many lines it holds. A line that
+// outgrows rx without a newline is passed on as it is.
+// serialLineKind() then picks the one parser a line needs from its first
+// letter; OK:, DEBUG: and echo lines fall straight through.
+const SERIAL_LINE_MAX = 4096;
+
+// state: a device (or serialRx) with rx / rxLen fields
+function splitSerialLines(state, chunk, onLine) {
+  let buf = chunk;
+  if (state.rxLen) {
+    if (state.rxLen + chunk.length <= SERIAL_LINE_MAX) {
+      chunk.copy(state.rx, state.rxLen);
+      buf = state.rx.subarray(0, state.rxLen + chunk.length);
+    } else {
+      buf = Buffer.concat([state.rx.subarray(0, state.rxLen), chunk]);
+    }
+    state.rxLen = 0;
+  }
+  const end = buf.lastIndexOf(0x0a);
+  if (end >= 0) {
+    const text = buf.toString('utf8', 0, end);
+    let start = 0;
+    let nl;
+    while ((nl = text.indexOf('\n', start)) >= 0) {
+      const line = text.slice(start, nl).trim();
+      start = nl + 1;
+      if (line) onLine(line);
+    }
+    const last = text.slice(start).trim();
+    if (last) onLine(last);
+  }
+  const rest = buf.length - end - 1;
+  if (rest === 0) return;
+  if (rest > SERIAL_LINE_MAX) {
+    const line = buf.toString('utf8', end + 1).trim();
+    if (line) onLine(line);
+    return;
+  }
+  if (!state.rx) state.rx = Buffer.allocUnsafe(SERIAL_LINE_MAX);
+  buf.copy(state.rx, 0, end + 1);
+  state.rxLen = rest;
+}
+
+// Case-insensitive test for an upper-case ASCII word at the start of a line
+function lineStartsWith(line, word) {
+  if (line.length < word.length) return false;
+  for (let i = 0; i < word.length; i++) {
+    if ((line.charCodeAt(i) & ~0x20) !== word.charCodeAt(i)) return false;
+  }
+  return true;
+}
+
+function serialLineKind(line) {
+  switch (line.charCodeAt(0) & ~0x20) {   // first letter, upper-cased
+    case 0x44: // D
+      if (lineStartsWith(line, 'DEVICE_ID')) return 'device-id';
+      if (lineStartsWith(line, 'DIAG')) return 'diag';
+      break;
+    case 0x56: // V
+      if (lineStartsWith(line, 'VERSION')) return 'version';
+      break;
+    case 0x4D: // M
+      if (lineStartsWith(line, 'MODE')) return 'mode';
+      break;
+    case 0x53: // S
+      if (lineStartsWith(line, 'SCREENS')) return 'screens';
+      break;
+    case 0x46: // F
+      if (line.startsWith('FWU:')) return 'fwu';
+      break;
+    case 0x45: // E
+      if (line.startsWith('ERR:') && /^ERR:\s*FWU/.test(line)) return 'fwu';
+      break;
+  }
+  return null;
+}
+
 // Multi-device: Handle serial data from specific device
 function onSerialDataMulti(device, chunk) {
   try {
-  const text = chunk.toString('utf8');
-  device.buffer += text;
-  let idx;
-  while ((idx = device.buffer.indexOf('\n')) >= 0) {
-    const line = device.buffer.slice(0, idx).trim();
-    device.buffer = device.buffer.slice(idx + 1);
-    if (line) {
-      // Send clean, line-based messages to the UI so they don't get split
-      wsBroadcast({ type: 'serial-data', deviceId: device.id, data: line });
-      console.log(`RECV from Device ${device.id}: ${line}`);
-      
+    splitSerialLines(device, chunk, line => onDeviceLine(device, line));
+  } catch (e) {
+    log.error(`CRITICAL: onSerialDataMulti error for device ${device.id}: ${e.stack || e}`);
+    uiLog(`FATAL: Serial data handler failed for device ${device.id}: ${e.message}`);
+  }
+}
+
+function onDeviceLine(device, line) {
+  const kind = serialLineKind(line);
+  // FWU replies belong to the update in progress, not the UI log
+  if (kind === 'fwu' && device.fwu) { device.fwu(line); return; }
+
+  // Send clean, line-based messages to the UI so they don't get split
+  wsBroadcast({ type: 'serial-data', deviceId: device.id, data: line });
+  if (log.debugOn) log.debug(`RECV from Device ${device.id}: ${line}`);
+
+  switch (kind) {
+    case 'device-id': {
       // Parse DEVICE_ID response
-      const deviceIdMatch = /^DEVICE_ID\s*[:=]\s*(\d+)/i.exec(line);
-      if (deviceIdMatch) {
-        device.deviceID = parseInt(deviceIdMatch[1]);
-        console.log(`✓ Device ${device.id} confirmed DEVICE_ID: ${device.deviceID}`);
+      const m = /^DEVICE_ID\s*[:=]\s*(\d+)/i.exec(line);
+      if (m) {
+        device.deviceID = parseInt(m[1]);
+        log.info(`✓ Device ${device.id} confirmed DEVICE_ID: ${device.deviceID}`);
       }
-      
+      break;
+    }
+    case 'diag':
+      storeDiagnostic(device.path, line);
+      break;
+    case 'screens': {
+      // Units with more than one mux show more than one 8-track block
+      const m = /^SCREENS\s*[:=]\s*(\d+)/i.exec(line);
+      const n = m ? Math.min(DEVICE_SCREENS_MAX, parseInt(m[1], 10)) : 0;
+      if (n >= 8 && n !== device.screens) {
+        device.screens = n;
+        rebuildRoutes();
+        log.info(`✓ Device ${device.id} has ${n} screens (${deviceSpan(device)} blocks)`);
+        try { replayTrackBlock(device); } catch {}
+      }
+      break;
+    }
+    case 'version': {
       // Parse VERSION response
-      const versionMatch = /^VERSION\s*[:=]\s*(.+)/i.exec(line);
-      if (versionMatch) {
-        device.version = versionMatch[1];
-        console.log(`✓ Device ${device.id} version: ${device.version}`);
+      const m = /^VERSION\s*[:=]\s*(.+)/i.exec(line);
+      if (m) {
+        device.version = m[1];
+        log.info(`✓ Device ${device.id} version: ${device.version}`);
         wsBroadcast({ type: 'device-version', version: device.version, path: device.path, deviceId: device.id });
       }
+      break;
     }
   }
-} catch (e) {
-  console.error(`CRITICAL: onSerialDataMulti error for device ${device.id}:`, e);
-  uiLog(`FATAL: Serial data handler failed for device ${device.id}: ${e.message}`);
-}
 }
 
 function onSerialData(chunk) {
-  const text = chunk.toString('utf8');
-  serialBuf += text;
-  let idx;
-  while ((idx = serialBuf.indexOf('\n')) >= 0) {
-    const line = serialBuf.slice(0, idx).trim();
-    serialBuf = serialBuf.slice(idx + 1);
-    const trimmedLine = line.trim();
-    if (trimmedLine) {
-      // Only broadcast clean lines, not raw buffer data
-      wsBroadcast({ type: 'serial-data', data: `Received: ${trimmedLine}` });
-      console.log(`RECV: ${trimmedLine}`);
-    }
-    const m = /^VERSION\s*[:=]\s*([\w.\-]+)/i.exec(line);
-    if (m) { deviceVersion = m[1]; wsBroadcast({ type: 'device-version', version: deviceVersion }); }
-    
-    // Parse MODE: WIRED or MODE: WIFI
-    const modeMatch = /^MODE\s*[:=]\s*(WIRED|WIFI)/i.exec(line);
-    if (modeMatch) {
+  splitSerialLines(serialRx, chunk, onLegacySerialLine);
+}
+
+function onLegacySerialLine(line) {
+  // Only broadcast clean lines, not raw buffer data
+  wsBroadcast({ type: 'serial-data', data: `Received: ${line}` });
+  if (log.debugOn) log.debug(`RECV: ${line}`);
+
+  switch (serialLineKind(line)) {
+    case 'diag':
+      storeDiagnostic(serialPath, line);
+      break;
+    case 'version': {
+      const m = /^VERSION\s*[:=]\s*([\w.\-]+)/i.exec(line);
+      if (m) { deviceVersion = m[1]; wsBroadcast({ type: 'device-version', version: deviceVersion }); }
+      break;
+    }
+    case 'mode': {
+      // Parse MODE: WIRED or MODE: WIFI
+      const modeMatch = /^MODE\s*[:=]\s*(WIRED|WIFI)/i.exec(line);
+      if (!modeMatch) break;
       const mode = modeMatch[1].toUpperCase();
       const connectionType = mode === 'WIRED' ? 'wired' : 'wifi';
       if (mode === 'WIRED') {
@@ -1037,11 +1634,19 @@ function onSerialData(chunk) {
       const ipNow = mode === 'WIRED' ? '127.0.0.1' : (deviceIP || 'pending…');
       uiLog(`IP: ${ipNow}`);
       uiLog(`OSC: Bridge listening ${OSC_LISTEN_PORT} (from M4L), sending ${M4L_PORT} (to M4L)`);
+      break;
     }
   }
 }
 
 // -------- API --------
+// GET /api/logs?limit=200&level=info - newest lines from the log ring
+app.get('/api/logs', (req, res) => {
+  const limit = Math.max(1, Math.min(LOG_RING_SIZE, parseInt(req.query.limit, 10) || 200));
+  const level = req.query.level in LOG_LEVELS ? req.query.level : 'debug';
+  res.json({ ok: true, level: Object.keys(LOG_LEVELS)[LOG_LEVEL], lines: log.tail(limit, level) });
+});
+
 app.get('/api/ports', async (_req, res) => {
   try {
     const ports = await listPorts();
@@ -1244,8 +1849,9 @@ app.post('/api/connect', async (req, res) => {
       id: deviceId,
       serial: newSerial,
       path: desired,
-      buffer: '',
+      rx: null, rxLen: 0,   // unterminated serial input (splitSerialLines)
       version: null,
+      screens: 8,           // panels on the unit (SCREENS in the VERSION reply)
       deviceID: deviceId,
       displayBlock: pathToDisplayBlock.has(desired) ? pathToDisplayBlock.get(desired) : deviceId
     };
@@ -1260,6 +1866,7 @@ app.post('/api/connect', async (req, res) => {
     });
     
     devices.push(device);
+    rebuildRoutes();
     
     console.log(`📊 [DEVICES] Array after connection:`, devices.map(d => `[ID=${d.deviceID}, path=${d.path}]`).join(', '));
     
@@ -1271,17 +1878,17 @@ app.post('/api/connect', async (req, res) => {
     });
     newSerial.on('close', () => {
       console.log(`🔌 Device ${deviceId} disconnected: ${desired}`);
+      forgetTrackSlots(deviceId);
       wsBroadcast({ type: 'serial-close', deviceId, path: desired });
       // Remove from devices array
       const index = devices.findIndex(d => d.id === deviceId);
-      if (index !== -1) devices.splice(index, 1);
+      if (index !== -1) { devices.splice(index, 1); rebuildRoutes(); }
     });
     
     // For first device, also set legacy global variables for backward compatibility
     if (devices.length > 0) {
       serial = newSerial;
       serialPath = desired;
-      serialBuf = device.buffer;
       deviceIP = '127.0.0.1';
     }
     
@@ -1306,6 +1913,7 @@ app.post('/api/connect', async (req, res) => {
         console.log(`📤 Sending init commands to Device ${deviceId + 1}...`);
         const block = (device && typeof device.displayBlock === 'number') ? device.displayBlock : deviceId;
         sendToDevice(deviceId, `DEVICE_ID ${block}\n`);
+        try { replayTrackBlock(device); } catch (e) { log.error(`❌ Track replay to Device ${deviceId + 1} failed: ${e.message}`); }
         setTimeout(() => sendToDevice(deviceId, 'VERSION\n'), 500);
       }
     }, 3000);
@@ -1344,12 +1952,14 @@ app.post('/api/connect-multi', async (req, res) => {
           id: deviceId,
           serial: newSerial,
           path: portPath,
-          buffer: '',
+          rx: null, rxLen: 0,   // unterminated serial input (splitSerialLines)
           version: null,
+          screens: 8,           // panels on the unit (SCREENS in the VERSION reply)
           deviceID: deviceId
         };
         
         devices.push(device);
+        rebuildRoutes();
         
         // Set up data handler for this device
         newSerial.on('data', (chunk) => onSerialDataMulti(device, chunk));
@@ -1389,12 +1999,14 @@ app.post('/api/send-command', (req, res) => {
           pathToDisplayBlock.set(path, block);
           const dev = devices.find(d => d.path === path);
           if (dev) dev.displayBlock = block;
+          rebuildRoutes();
           console.log(`🧭 Mapped ${path} -> displayBlock ${block}`);
         } else if (deviceId !== undefined) {
           const dev = devices.find(d => d.id === deviceId || d.deviceID === deviceId);
           if (dev) {
             dev.displayBlock = block;
             pathToDisplayBlock.set(dev.path, block);
+            rebuildRoutes();
             console.log(`🧭 Mapped deviceId ${dev.id} (${dev.path}) -> displayBlock ${block}`);
           }
         }
@@ -1518,6 +2130,7 @@ app.post('/api/disconnect-all', async (req, res) => {
 
     // Clear in-memory tracking so reconnection starts clean
     devices = [];
+    rebuildRoutes();
     connectingPorts.clear();
     portToDeviceId.clear();
     recentlyClosed.clear();
@@ -1564,10 +2177,11 @@ let currentTrackNames = [
   'Track 1', 'Track 2', 'Track 3', 'Track 4',
   'Track 5', 'Track 6', 'Track 7', 'Track 8'
 ];
-let globalTrackNames = new Array(32).fill('');
+let currentTrackNamesOnDisk = false;
 try {
   const raw = fs.readFileSync(TRACK_NAMES_PATH, 'utf8');
   const parsed = JSON.parse(raw);
+  currentTrackNamesOnDisk = true;
   if (Array.isArray(parsed) && parsed.length === 8) {
     currentTrackNames = parsed.map(v => (typeof v === 'string' ? v : String(v || '')));
     console.log('✓ Loaded track names from disk');
@@ -1576,6 +2190,101 @@ try {
   // No file yet or parse error; keep defaults silently
 }
 
+// Names saved from the UI (POST /api/tracknames), kept in memory so GETs never touch the disk
+const SAVED_TRACK_NAMES_PATH = path.join(__dirname, 'track_names.json');
+let savedTrackNames = null;
+try {
+  const json = JSON.parse(fs.readFileSync(SAVED_TRACK_NAMES_PATH, 'utf8'));
+  savedTrackNames = Array.isArray(json) ? json : (json && Array.isArray(json.names) ? json.names : []);
+} catch {}
+
+// ---- Track store ----
+// globalTrackNames is the bridge's authoritative copy of the Live set's names.
+// Every name from M4L or the UI goes through storeTrackName(), and the store
+// (names plus the active track) is written behind to track_state.json at most
+// once per TRACK_STORE_FLUSH_MS, via a temp file and a rename so a crash never
+// leaves half a file. A device that (re)connects gets its whole block replayed
+// from here as soon as it has booted; Live is only asked again when the store
+// has not had a full snapshot from it since the last /hi.
+const TRACK_STATE_PATH = path.join(__dirname, 'track_state.json');
+const TRACK_STORE_FLUSH_MS = 1000;
+let globalTrackNames = new Array(TRACK_COUNT).fill('');
+let trackStoreSynced = false;   // a full snapshot (or sweep) arrived since the last /hi
+let trackStoreTimer = null;
+let trackStoreWriting = false;
+try {
+  const parsed = JSON.parse(fs.readFileSync(TRACK_STATE_PATH, 'utf8'));
+  if (parsed && Array.isArray(parsed.names)) {
+    for (let i = 0; i < TRACK_COUNT; i++) {
+      const v = parsed.names[i];
+      globalTrackNames[i] = typeof v === 'string' ? v : '';
+    }
+    if (Number.isInteger(parsed.activeTrack)) lastActiveTrackIndex = parsed.activeTrack;
+    log.info('✓ Loaded track state from disk');
+  }
+} catch {}
+
+function storeTrackName(at, name) {
+  if (!(at >= 0 && at < TRACK_COUNT) || globalTrackNames[at] === name) return;
+  globalTrackNames[at] = name;
+  scheduleTrackStoreFlush();
+}
+
+function scheduleTrackStoreFlush() {
+  if (!trackStoreTimer) trackStoreTimer = setTimeout(flushTrackStore, TRACK_STORE_FLUSH_MS);
+}
+
+function trackStoreJson() {
+  return JSON.stringify({ names: globalTrackNames, activeTrack: lastActiveTrackIndex }, null, 2);
+}
+
+async function flushTrackStore() {
+  trackStoreTimer = null;
+  if (trackStoreWriting) { scheduleTrackStoreFlush(); return; }
+  trackStoreWriting = true;
+  const tmpPath = TRACK_STATE_PATH + '.tmp';
+  try {
+    await fs.promises.writeFile(tmpPath, trackStoreJson(), 'utf8');
+    await fs.promises.rename(tmpPath, TRACK_STATE_PATH);
+  } catch (e) {
+    log.error(`❌ Saving track state failed: ${e.message}`);
+  }
+  trackStoreWriting = false;
+}
+
+// On shutdown: write out anything still waiting for the timer
+function flushTrackStoreSync() {
+  if (!trackStoreTimer) return;
+  clearTimeout(trackStoreTimer);
+  trackStoreTimer = null;
+  try {
+    fs.writeFileSync(TRACK_STATE_PATH + '.tmp', trackStoreJson(), 'utf8');
+    fs.renameSync(TRACK_STATE_PATH + '.tmp', TRACK_STATE_PATH);
+  } catch {}
+}
+
+// Write all of a device's blocks and the active track from the store in one
+// bulk write. Returns false when the store knows nothing for them.
+function replayTrackBlock(device) {
+  const first = deviceBlock(device) * 8;
+  const last = Math.min(TRACK_COUNT, first + deviceSpan(device) * 8);
+  const names = [];
+  for (let at = first; at < last; at++) names.push(globalTrackNames[at] || '');
+  if (!names.some(Boolean)) return false;
+  forgetTrackSlots(device.id);
+  const lines = names.map((name, i) => {
+    shouldSendTrackname(device.id, i, normalizeName(name));
+    return `/trackname ${i} "${name.replace(/"/g, '\\"')}" ${first + i}\n`;
+  });
+  if (lastActiveTrackIndex !== null) {
+    const local = lastActiveTrackIndex >= first && lastActiveTrackIndex < last ? lastActiveTrackIndex - first : -1;
+    lines.push(`/activetrack ${local}\n`);
+  }
+  sendToDevice(device.id, lines.join(''));
+  log.info(`⚡ Replayed tracks ${first + 1}-${last} to Device ${device.id + 1} from the track store`);
+  return true;
+}
+
 app.get('/tracks', (_req, res) => {
   res.json({ names: currentTrackNames });
 });
@@ -1584,8 +2293,8 @@ app.get('/tracks', (_req, res) => {
 app.get('/api/tracknames', (req, res) => {
   try {
     const base = Array.isArray(globalTrackNames) ? globalTrackNames : [];
-    const out = new Array(32).fill('');
-    for (let i = 0; i < 32; i++) {
+    const out = new Array(TRACK_COUNT).fill('');
+    for (let i = 0; i < TRACK_COUNT; i++) {
       const v = base[i];
       if (typeof v === 'string' && v.length) out[i] = v;
     }
@@ -1601,32 +2310,18 @@ app.get('/api/tracknames', (req, res) => {
 
 app.get('/api/tracknames/saved', (req, res) => {
   try {
-    const savedPath = path.join(__dirname, 'track_names.json');
-    if (fs.existsSync(savedPath)) {
-      const raw = fs.readFileSync(savedPath, 'utf8');
-      const json = JSON.parse(raw);
-      let names = Array.isArray(json) ? json : (json && Array.isArray(json.names) ? json.names : []);
-      const out = new Array(32).fill('');
-      for (let i = 0; i < Math.min(32, names.length); i++) {
-        const v = names[i];
-        out[i] = typeof v === 'string' ? v : String(v || '');
-      }
-      return res.json({ ok: true, names: out });
-    }
-    if (fs.existsSync(TRACK_NAMES_PATH)) {
-      const raw = fs.readFileSync(TRACK_NAMES_PATH, 'utf8');
-      const parsed = JSON.parse(raw);
-      let names = Array.isArray(parsed) ? parsed : [];
-      const out = new Array(32).fill('');
-      for (let i = 0; i < Math.min(32, names.length); i++) {
+    const names = savedTrackNames || (currentTrackNamesOnDisk ? currentTrackNames : null);
+    if (names) {
+      const out = new Array(TRACK_COUNT).fill('');
+      for (let i = 0; i < Math.min(TRACK_COUNT, names.length); i++) {
         const v = names[i];
         out[i] = typeof v === 'string' ? v : String(v || '');
       }
       return res.json({ ok: true, names: out });
     }
     const base = Array.isArray(globalTrackNames) ? globalTrackNames : [];
-    const out = new Array(32).fill('');
-    for (let i = 0; i < 32; i++) {
+    const out = new Array(TRACK_COUNT).fill('');
+    for (let i = 0; i < TRACK_COUNT; i++) {
       const v = base[i];
       if (typeof v === 'string' && v.length) out[i] = v;
     }
@@ -1647,14 +2342,14 @@ app.post('/api/tracknames', (req, res) => {
         return res.status(400).json({ ok: false, error: 'Invalid data format' });
     }
 
-    const filePath = path.join(__dirname, 'track_names.json');
     const data = JSON.stringify({ names }, null, 2);
 
-    fs.writeFile(filePath, data, 'utf8', (err) => {
+    fs.writeFile(SAVED_TRACK_NAMES_PATH, data, 'utf8', (err) => {
         if (err) {
             console.error('❌ Error saving track names:', err);
             return res.status(500).json({ ok: false, error: 'Failed to save track names' });
         }
+        savedTrackNames = names;
         return res.json({ ok: true });
     });
 });
@@ -1688,70 +2383,34 @@ app.post('/api/trackname', (req, res) => {
     let atRaw = Number(actualTrack);
     let at = Number.isFinite(atRaw) ? atRaw : Number(index);
 
-    // Treat actualTrack as a zero-based global index (0..31).
+    // Treat actualTrack as a zero-based global index (0..TRACK_COUNT-1).
     // If it's missing or out of range, fall back to the provided local index.
-    if (!Number.isFinite(at) || at < 0 || at >= 32) {
+    if (!Number.isFinite(at) || at < 0 || at >= TRACK_COUNT) {
       at = Number(index);
     }
-    const cmd = `/trackname ${index} "${esc}" ${at}\n`;
     // Global dedup: suppress duplicate track name updates for the same actual track
     if (!shouldForwardGlobal(Number(at), escNorm)) {
       console.log(` Deduped global /api/trackname for track ${at}`);
       return res.json({ ok: true, dedup: true });
     }
 
-    if (Number.isFinite(at) && at >= 0 && at < 32) {
-      try { globalTrackNames[Number(at)] = nameStr; } catch {}
-    }
-    // Calculate which device should receive this track (based on actualTrack)
-    const targetDeviceId = Math.floor(at / 8);
-
-    console.log('[TRACKNAME] Routing:', {
-      index,
-      name: name,
-      actualTrack: at,
-      targetDeviceId,
-      devicesCount: devices.length,
-      availableDevices: devices.map(d => `ID=${d.deviceID}`).join(', ')
-    });
-
-    // Route to correct device if multi-device mode
-    if (devices.length > 1) {
-      console.log(` [ROUTING] Looking for deviceId=${targetDeviceId} for track ${at}`);
-      const targetDevice = devices.find(d => d.deviceID === targetDeviceId || d.id === targetDeviceId);
-      if (targetDevice) {
-        if (shouldSendTrackname(targetDevice.id, index, escNorm)) {
-          sendToDevice(targetDevice.id, cmd);
-          console.log(` [Device ${targetDeviceId}] ${targetDevice.path} ← Track ${at}: "${name}"`);
-        } else {
-          console.log(` Deduped /api/trackname for Device ${targetDevice.id} idx ${index}`);
-        }
-      } else {
-        console.warn(` Device ${targetDeviceId} not found for track ${at}. Available:`, devices.map(d => `[ID=${d.deviceID}, path=${d.path}]`).join(', '));
-        console.warn(` Falling back to first device`);
-        if (shouldSendTrackname(0, index, escNorm)) send(cmd);
-      }
-    } else {
-      // Single device mode: prefer multi-device pipe if available
-      if (devices.length > 0) {
-        const d0 = devices[0];
-        if (shouldSendTrackname(d0.id, index, escNorm)) {
-          sendToDevice(d0.id, cmd);
-          console.log(` [Device ${d0.deviceID}] ${d0.path} ← Track ${at}: "${name}"`);
-        } else {
-          console.log(` Deduped /api/trackname for Device ${d0.id} idx ${index}`);
-        }
-      } else if (serial && serial.isOpen) {
-        // Legacy single-serial fallback
-        if (shouldSendTrackname(0, index, escNorm)) send(cmd);
-        console.log(` [Serial] ← Track ${at}: "${name}"`);
-      } else {
-        throw new Error('No connected device to send trackname');
+    storeTrackName(Number(at), nameStr);
+    // Route by global track through the routing table
+    const targets = trackNameTargets(Math.floor(at / 8));
+    if (targets.length === 0 && devices.length === 0) throw new Error('No connected device to send trackname');
+    if (targets.length === 0) log.info(`Track ${at} is not on any connected device; stored only`);
+    for (const t of targets) {
+      const panel = t.base + (at % 8);
+      if (!shouldSendTrackname(t.key, panel, escNorm)) {
+        log.info(` Deduped /api/trackname for Device ${t.key} idx ${panel}`);
+        continue;
       }
+      t.write(`/trackname ${panel} "${esc}" ${at}\n`);
+      log.info(` [Device ${t.key}] ${t.device ? t.device.path : '(serial)'} ← Track ${at}: "${name}"`);
     }
 
     // Persist asynchronously; ignore errors
-    try { fs.promises.writeFile(TRACK_NAMES_PATH, JSON.stringify(currentTrackNames, null, 2), 'utf8'); } catch {}
+    try { fs.promises.writeFile(TRACK_NAMES_PATH, JSON.stringify(currentTrackNames, null, 2), 'utf8'); currentTrackNamesOnDisk = true; } catch {}
     res.json({ ok: true });
   } catch (e) { 
     console.error(' /api/trackname error:', e);
@@ -1764,27 +2423,8 @@ app.post('/api/activetrack', (req, res) => {
     const { index } = req.body || {};
     if (!Number.isFinite(index)) throw new Error('Missing index');
 
-    if (devices.length > 0) {
-      const deviceId = Math.floor(index / 8);
-      const localIndex = index % 8;
-      const targetDevice = devices.find(d => d.id === deviceId);
-      if (targetDevice) {
-        console.log(`📢 Routing ACTIVETRACK ${index} → Device ${deviceId} (local ${localIndex})`);
-        // Send selection to target device
-        sendToDevice(deviceId, `/activetrack ${localIndex}\n`);
-        // Clear selection on all other devices
-        devices.filter(d => d.id !== deviceId && d.serial && d.serial.isOpen)
-               .forEach(d => sendToDevice(d.id, `/activetrack -1\n`));
-      } else if (devices.length === 1) {
-        console.log(`📢 Single device present; sending local index ${localIndex}`);
-        sendToDevice(devices[0].id, `/activetrack ${localIndex}\n`);
-      } else {
-        console.log(`📢 No exact device match; clearing all`);
-        sendToAll(`/activetrack -1\n`);
-      }
-    } else {
-      send(`/activetrack ${index}\n`);
-    }
+    if (index < 0 || index >= TRACK_COUNT) throw new Error(`index must be 0-${TRACK_COUNT - 1}`);
+    routeActiveTrack(index);
 
     res.json({ ok: true });
   } catch (e) {
@@ -1966,6 +2606,14 @@ app.get('/api/device-status', (req, res) => {
   });
 });
 
+// Latest OLED_Diagnostic bus characterisation per serial port
+app.get('/api/diagnostics', (_req, res) => {
+  try {
+    const all = fs.existsSync(DIAGNOSTICS_PATH) ? JSON.parse(fs.readFileSync(DIAGNOSTICS_PATH, 'utf8')) : {};
+    res.json({ ok: true, devices: all });
+  } catch (e) { res.status(500).json({ ok: false, error: e.message }); }
+});
+
 // Diagnostic endpoint - check OSC port status
 app.get('/api/osc-status', (req, res) => {
   const now = Date.now();
@@ -2050,15 +2698,11 @@ app.post('/api/ota-update', async (req, res) => {
   return res.status(501).json({ ok: false, error: 'WiFi/OTA is disabled in this build' });
 });
 
-// Flash firmware over USB using esptool (wired-only)
-let FLASH_IN_PROGRESS = false;
-
+// Flash firmware over USB using esptool (wired-only). Takes one target
+// (deviceId or path) or several (deviceIds or paths); see flashFleet.
 app.post('/api/flash', async (req, res) => {
   try {
-    if (FLASH_IN_PROGRESS) {
-      return res.status(429).json({ ok: false, error: 'Another flash is in progress. Please wait.' });
-    }
-    const { url, manifest, deviceId, path: portPathOverride } = req.body || {};
+    const { url, manifest, deviceId, deviceIds, path: portPathOverride, paths } = req.body || {};
     let fwUrl = url;
     if (!fwUrl && manifest) {
       try {
@@ -2071,71 +2715,235 @@ app.post('/api/flash', async (req, res) => {
     }
     if (!fwUrl) throw new Error('Missing firmware url or manifest');
 
-    // Decide which port to flash
-    let targetDevice = null;
-    if (typeof deviceId === 'number') {
-      targetDevice = devices.find(d => d.id === deviceId || d.deviceID === deviceId) || null;
+    // Decide which ports to flash
+    let portPaths;
+    if (Array.isArray(paths) && paths.length) {
+      portPaths = paths;
+    } else if (Array.isArray(deviceIds) && deviceIds.length) {
+      portPaths = devices.filter(d => deviceIds.includes(d.id) || deviceIds.includes(d.deviceID)).map(d => d.path);
+    } else {
+      let targetDevice = null;
+      if (typeof deviceId === 'number') {
+        targetDevice = devices.find(d => d.id === deviceId || d.deviceID === deviceId) || null;
+      }
+      const portPath = portPathOverride || (targetDevice ? targetDevice.path : (devices[0] && devices[0].path) || serialPath);
+      portPaths = portPath ? [portPath] : [];
     }
-    let portPath = portPathOverride || (targetDevice ? targetDevice.path : (devices[0] && devices[0].path) || serialPath);
-    if (!portPath) throw new Error('No connected device to flash');
+    if (!portPaths.length) throw new Error('No connected device to flash');
 
-    // Download firmware to temp
-    const fwPath = await fetchToTemp(fwUrl);
+    const report = await flashFleet(portPaths, fwUrl, { offset: '0x10000', fullErase: false, baud: 921600 });
+    flashResponse(res, report);
+  } catch (e) {
+    console.error('Flash error:', e);
+    return res.status(e.code === 'BUSY' ? 429 : 400).json({ ok: false, error: e.message });
+  }
+});
 
-    // Close serial if open on this port
-    try {
-      if (targetDevice && targetDevice.serial && targetDevice.serial.isOpen) {
-        await new Promise((resolve, reject) => targetDevice.serial.close(err => err ? reject(err) : resolve()));
-      } else if (serial && serial.isOpen && serialPath === portPath) {
-        await new Promise((resolve, reject) => serial.close(err => err ? reject(err) : resolve()));
+// -------- In-app firmware update over USB serial (FWU) --------
+// Streams the image to the running firmware over the port that is already
+// open: no ROM bootloader, no re-enumeration. See the firmware's FWU
+// section for the line protocol. Images go out gzip'd when the unit can
+// inflate them; all target devices update in parallel, and a dropped or
+// stalled link is retried with a fresh BEGIN, which resumes at the offset
+// the device already holds.
+const FWU_CHUNK = 512;          // bytes per DATA line (firmware accepts up to 768)
+const FWU_WINDOW = 4;           // DATA lines in flight before an ACK is needed
+const FWU_TIMEOUT_MS = 3000;    // silence before resending from the last ACK
+const FWU_RETRIES = 5;          // resends per session before giving up
+const FWU_ATTEMPTS = 3;         // sessions (BEGIN ... END) per device
+
+const CRC32_TABLE = (() => {
+  const t = new Uint32Array(256);
+  for (let n = 0; n < 256; n++) {
+    let c = n;
+    for (let k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >>> 1) : c >>> 1;
+    t[n] = c >>> 0;
+  }
+  return t;
+})();
+
+function crc32(buf) {
+  let c = 0xFFFFFFFF;
+  for (let i = 0; i < buf.length; i++) c = CRC32_TABLE[(c ^ buf[i]) & 0xFF] ^ (c >>> 8);
+  return (c ^ 0xFFFFFFFF) >>> 0;
+}
+
+// One BEGIN ... END exchange. Resolves with { written, sha256 } on DONE.
+function fwuSession(device, image, sha256, onProgress) {
+  return new Promise((resolve, reject) => {
+    let acked = 0, sent = 0, rewind = -1, retries = 0, state = 'begin', timer = null;
+    const beginCmd = `FWU BEGIN ${image.length} ${sha256}\n`;
+
+    const finish = (err, info) => {
+      clearTimeout(timer);
+      device.fwu = null;
+      err ? reject(err) : resolve(info);
+    };
+    const write = (s) => {
+      if (!device.serial || !device.serial.isOpen) throw new Error('serial port closed');
+      device.serial.write(s);
+    };
+    const arm = () => {
+      clearTimeout(timer);
+      timer = setTimeout(() => {
+        if (++retries > FWU_RETRIES) return finish(new Error(`no reply from device (${state})`));
+        try {
+          if (state === 'begin') write(beginCmd);
+          else if (state === 'end') write('FWU END\n');
+          else { sent = acked; pump(); }
+          arm();
+        } catch (e) { finish(e); }
+      }, FWU_TIMEOUT_MS);
+    };
+    const pump = () => {
+      while (sent < image.length && sent - acked < FWU_WINDOW * FWU_CHUNK) {
+        const chunk = image.subarray(sent, sent + FWU_CHUNK);
+        const crc = crc32(chunk).toString(16).padStart(8, '0');
+        write(`FWU DATA ${sent} ${crc} ${chunk.toString('base64')}\n`);
+        sent += chunk.length;
       }
-    } catch {}
+      if (acked === image.length && state === 'data') {
+        state = 'end';
+        write('FWU END\n');
+      }
+    };
 
-    // Try python/esptool runners in order (streamed, no maxBuffer)
-    const localEsptool = process.platform === 'win32' ? path.join(__dirname, 'bin', 'esptool.exe') : path.join(__dirname, 'bin', 'esptool');
-    const runners = [
-      { cmd: localEsptool, args: ['--chip', 'esp32c3', '--port', portPath, '--baud', '921600', 'write_flash', '-z', '0x10000', fwPath] },
-      { cmd: 'python', args: ['-m', 'esptool', '--chip', 'esp32c3', '--port', portPath, '--baud', '921600', 'write_flash', '-z', '0x10000', fwPath] },
-      { cmd: 'py', args: ['-m', 'esptool', '--chip', 'esp32c3', '--port', portPath, '--baud', '921600', 'write_flash', '-z', '0x10000', fwPath] },
-      { cmd: 'python3', args: ['-m', 'esptool', '--chip', 'esp32c3', '--port', portPath, '--baud', '921600', 'write_flash', '-z', '0x10000', fwPath] },
-      { cmd: 'esptool.py', args: ['--chip', 'esp32c3', '--port', portPath, '--baud', '921600', 'write_flash', '-z', '0x10000', fwPath] }
-    ];
-
-    FLASH_IN_PROGRESS = true;
-    let lastErr = null;
-    for (const r of runners) {
+    device.fwu = (line) => {
       try {
-        uiLog(`[FLASH] Running: ${r.cmd} ${r.args.join(' ')}`);
-        await new Promise((resolve, reject) => {
-          const child = spawn(r.cmd, r.args, { windowsHide: true, stdio: ['ignore', 'pipe', 'pipe'] });
-          let done = false;
-          const finish = (err) => { if (!done) { done = true; err ? reject(err) : resolve(); } };
-          child.stdout.on('data', d => { const t = d.toString(); if (t.trim()) uiLog(t); });
-          child.stderr.on('data', d => { const t = d.toString(); if (t.trim()) uiLog(t); });
-          child.on('error', e => finish(e));
-          child.on('close', code => {
-            if (code === 0) finish(); else finish(new Error(`esptool exit ${code}`));
-          });
-        });
-        uiLog('[FLASH] Completed successfully. Device will reboot.');
-        FLASH_IN_PROGRESS = false;
-        return res.json({ ok: true });
-      } catch (e) {
-        lastErr = e;
-        uiLog(`[FLASH] Failed with runner: ${e.message}`);
+        let m;
+        if ((m = /^FWU:\s*READY\s+(\d+)(?:\s+inflate=(\d))?/.exec(line))) {
+          if (state !== 'begin') return;
+          if (image[0] === 0x1f && m[2] === '0') {
+            write('FWU ABORT\n');
+            const e = new Error('device cannot inflate gzip images');
+            e.code = 'NO_INFLATE';
+            return finish(e);
+          }
+          acked = sent = Math.min(parseInt(m[1], 10), image.length);
+          if (acked) uiLog(`[FWU] ${device.path}: resuming at ${acked}/${image.length}`);
+          state = 'data';
+          retries = 0;
+          onProgress(acked, image.length);
+          pump();
+          arm();
+        } else if ((m = /^FWU:\s*ACK\s+(\d+)/.exec(line))) {
+          const n = parseInt(m[1], 10);
+          if (n > acked) {
+            acked = n;
+            retries = 0;
+            if (n > rewind) rewind = -1;
+            onProgress(acked, image.length);
+          }
+          pump();
+          arm();
+        } else if ((m = /^FWU:\s*NAK\s+(\d+)/.exec(line))) {
+          // Later lines of the same window NAK too; rewind once per offset
+          const n = parseInt(m[1], 10);
+          if (n !== rewind && n < sent) {
+            rewind = n;
+            acked = Math.max(acked, n);
+            sent = n;
+            pump();
+          }
+          arm();
+        } else if ((m = /^FWU:\s*DONE\s+(\d+)\s+([0-9a-f]+)/i.exec(line))) {
+          finish(null, { written: parseInt(m[1], 10), sha256: m[2] });
+        } else if (/^ERR:\s*FWU/.test(line)) {
+          finish(new Error(line.replace(/^ERR:\s*/, '')));
+        }
+      } catch (e) { finish(e); }
+    };
+
+    try { write(beginCmd); arm(); } catch (e) { finish(e); }
+  });
+}
+
+async function fwuDevice(device, images, sha256) {
+  let image = images.gz;
+  let lastPct = -1;
+  const onProgress = (done, total) => {
+    const pct = Math.floor(done * 100 / total);
+    if (pct === lastPct) return;
+    lastPct = pct;
+    wsBroadcast({ type: 'fwu-progress', path: device.path, deviceId: device.id, pct });
+  };
+  for (let attempt = 1; ; attempt++) {
+    try {
+      const t0 = Date.now();
+      const r = await fwuSession(device, image, sha256, onProgress);
+      uiLog(`[FWU] ${device.path}: ${image.length} bytes in ${((Date.now() - t0) / 1000).toFixed(1)}s, verified, rebooting`);
+      return r;
+    } catch (e) {
+      if (e.code === 'NO_INFLATE' && image !== images.plain) {
+        uiLog(`[FWU] ${device.path}: no inflater on device, sending the plain image`);
+        image = images.plain;
+        attempt--;
         continue;
       }
+      if (attempt >= FWU_ATTEMPTS || !device.serial || !device.serial.isOpen) throw e;
+      uiLog(`[FWU] ${device.path}: ${e.message}; retrying (${attempt + 1}/${FWU_ATTEMPTS})`);
+    }
+  }
+}
+
+app.post('/api/firmware/serial-update', async (req, res) => {
+  try {
+    const { firmwareUrl, manifest, paths } = req.body || {};
+    let url = firmwareUrl;
+    let expected = req.body && req.body.sha256;
+    if (!url && manifest) {
+      const mPath = await fetchToTemp(manifest);
+      const man = JSON.parse(await fs.promises.readFile(mPath, 'utf8'));
+      url = man && man.url;
+      expected = expected || (man && man.sha256);
+    }
+    if (!url) throw new Error('Missing firmware url or manifest');
+    // The hash is the only thing vouching for the image, so never fall back
+    // to the hash of whatever was downloaded
+    expected = String(expected || '').toLowerCase();
+    if (!/^[0-9a-f]{64}$/.test(expected)) {
+      throw new Error('No sha256 for this image: pass sha256 or use a manifest that has one (pack_ota.js writes it)');
+    }
+
+    const targets = devices.filter(d => d.serial && d.serial.isOpen &&
+      (!Array.isArray(paths) || paths.includes(d.path)));
+    if (!targets.length) throw new Error('No connected device to update');
+    if (targets.some(d => d.fwu)) {
+      return res.status(409).json({ ok: false, error: 'An update is already running on one of these devices' });
     }
-    FLASH_IN_PROGRESS = false;
-    throw new Error(lastErr ? lastErr.message : 'Unknown flashing error');
+
+    uiLog(`[FWU] Downloading firmware from ${url}...`);
+    const response = await axios.get(url, { responseType: 'arraybuffer' });
+    const raw = Buffer.from(response.data);
+    const plain = plainFirmware(raw);
+    const sha256 = crypto.createHash('sha256').update(plain).digest('hex');
+    if (expected !== sha256) {
+      throw new Error('Downloaded image does not match the manifest sha256');
+    }
+    const images = { plain, gz: plain === raw ? zlib.gzipSync(plain, { level: 9 }) : raw };
+    uiLog(`[FWU] ${plain.length} byte image (${images.gz.length} gzip'd) -> ${targets.length} device(s)`);
+
+    const results = await Promise.allSettled(targets.map(d => fwuDevice(d, images, sha256)));
+    const report = targets.map((d, i) => results[i].status === 'fulfilled'
+      ? { path: d.path, ok: true, ...results[i].value }
+      : { path: d.path, ok: false, error: results[i].reason.message });
+    report.filter(r => !r.ok).forEach(r => uiLog(`[FWU] ${r.path} failed: ${r.error}`));
+    const ok = report.every(r => r.ok);
+    res.status(ok ? 200 : 500).json({ ok, devices: report });
   } catch (e) {
-    FLASH_IN_PROGRESS = false;
-    console.error('Flash error:', e);
-    return res.status(400).json({ ok: false, error: e.message });
+    log.error(`FWU error: ${e.message}`);
+    res.status(400).json({ ok: false, error: e.message });
   }
 });
 
 // -------- Utils --------
+// OTA manifests may point at gzip'd images (the firmware inflates them
+// itself); esptool needs the plain .bin
+function plainFirmware(buf) {
+  if (buf.length > 2 && buf[0] === 0x1f && buf[1] === 0x8b) return zlib.gunzipSync(buf);
+  return buf;
+}
+
 async function fetchToTemp(url, redirects = 5) {
   const isHttps = url.startsWith('https:');
   const mod = await (isHttps ? import('node:https') : import('node:http'));
@@ -2176,6 +2984,18 @@ wss.on('connection', ws => {
     ws.send(JSON.stringify({ type: 'serial-data', data: msg1 }));
     ws.send(JSON.stringify({ type: 'serial-data', data: msg3 }));
   } catch {}
+  ws.on('message', raw => {
+    let msg;
+    try { msg = JSON.parse(raw); } catch { return; }
+    if (msg && msg.type === 'log-level' && msg.level in LOG_LEVELS) {
+      ws.logLevel = LOG_LEVELS[msg.level];
+      log.refresh();
+    } else if (msg && msg.type === 'subscribe') {
+      const topics = Array.isArray(msg.topics) ? msg.topics.filter(t => WS_TOPICS.has(t)) : [];
+      ws.topics = topics.length ? new Set(topics) : null;
+    }
+  });
+  ws.on('close', () => log.refresh());
 });
 
 // Auto-connect to all TDS-8 devices
@@ -2235,6 +3055,10 @@ async function autoConnectDevices() {
         console.log(`⏳ Skipping ${port.path} (cooldown ${(RECONNECT_COOLDOWN_MS - (now - lastClosed))}ms)`);
         continue;
       }
+      if (flashingPorts.has(port.path)) {
+        log.info(`⚡ Skipping ${port.path} (flashing)`);
+        continue;
+      }
       if (alreadyConnected || connectingPorts.has(port.path)) {
         if (alreadyConnected) console.log(`⏭️  ${port.path} already connected as Device ${alreadyConnected.id}`);
         if (connectingPorts.has(port.path)) console.log(`⏳ ${port.path} connection in progress...`);
@@ -2280,8 +3104,9 @@ async function autoConnectDevices() {
           id: deviceId,
           serial: newSerial,
           path: port.path,
-          buffer: '',
+          rx: null, rxLen: 0,   // unterminated serial input (splitSerialLines)
           version: null,
+          screens: 8,           // panels on the unit (SCREENS in the VERSION reply)
           deviceID: deviceId,
           displayBlock: pathToDisplayBlock.has(port.path) ? pathToDisplayBlock.get(port.path) : deviceId
         };
@@ -2291,6 +3116,7 @@ async function autoConnectDevices() {
         await new Promise(res => setTimeout(res, 1000));
         
         devices.push(device);
+        rebuildRoutes();
         
         newSerial.on('data', (chunk) => onSerialDataMulti(device, chunk));
         newSerial.on('error', e => {
@@ -2298,8 +3124,9 @@ async function autoConnectDevices() {
         });
         newSerial.on('close', () => {
           console.log(`🔌 Device ${deviceId} disconnected: ${port.path}`);
+          forgetTrackSlots(deviceId);
           const index = devices.findIndex(d => d.id === deviceId);
-          if (index !== -1) devices.splice(index, 1);
+          if (index !== -1) { devices.splice(index, 1); rebuildRoutes(); }
           // Do NOT auto-reconnect - let user manually reconnect like Arduino IDE
           recentlyClosed.set(port.path, Date.now());
           connectingPorts.delete(port.path);
@@ -2319,6 +3146,7 @@ async function autoConnectDevices() {
             console.log(`📤 Sending init commands to Device ${deviceId + 1}...`);
             const block = (device && typeof device.displayBlock === 'number') ? device.displayBlock : deviceId;
             sendToDevice(deviceId, `DEVICE_ID ${block}\n`);
+            try { replayTrackBlock(device); } catch (e) { log.error(`❌ Track replay to Device ${deviceId + 1} failed: ${e.message}`); }
             setTimeout(() => sendToDevice(deviceId, 'VERSION\n'), 500);
           }
         }, 3000);